@@ -34,8 +34,14 @@ namespace Collection
      * are allowed. Memory allocation is based on arrays.
      * @param T can be any type as long as it has a default intializer.
      *          Usually smart pointers.
+     * @param A allocation policy for this ArrayList and its storage
+     *          (see Memory/src/Allocator.hpp), Memory::InlineStorage<N> to
+     *          store up to N items inline, or Memory::SmallStorage<N> to
+     *          store the first N items inline. Memory::HeapAllocator by default.
+     * @param P capacity policy, deciding when the array grows and shrinks
+     *          (see src/CapacityPolicy.hpp). CapacityPolicy<> by default.
      */
-    template <typename T>
+    template<typename T, typename A = Memory::HeapAllocator, typename P = CapacityPolicy<>>
     class ArrayList : public UnorderedList<T>
     {
     public:
@@ -50,7 +56,31 @@ namespace Collection
          */
         bool add(const T& item, uint16_t index = 0) override
         {
-            return _container->add(item, index);
+            return _container.add(item, index);
+        }
+
+        /**
+         * Tries to move the provided item in this ArrayList
+         * at the specified index (at the beginning if no index is provided).
+         * @param item to add.
+         * @param index where to add the item. Must be within bounds. 0 by default.
+         * @return true if adding was succesfull, false otherwise.
+         */
+        bool add(T&& item, uint16_t index = 0) override
+        {
+            return _container.add(Memory::move(item), index);
+        }
+
+        /**
+         * Tries to construct an item in place at the specified index.
+         * @param index where to add the item. Must be within bounds.
+         * @param args must match one of T's constructors.
+         * @return true if adding was succesfull, false otherwise.
+         */
+        template<class... Args>
+        bool emplace(uint16_t index, Args&&... args)
+        {
+            return _container.emplace(index, Memory::forward<Args>(args)...);
         }
 
         /**
@@ -60,7 +90,51 @@ namespace Collection
          */
         void append(const T& item) override
         {
-            _container->add(item, size());
+            _container.add(item, size());
+        }
+
+        /**
+         * Moves the provided item in at the end of this
+         * ArrayList.
+         * @param item to add.
+         */
+        void append(T&& item) override
+        {
+            _container.add(Memory::move(item), size());
+        }
+
+        /**
+         * Constructs an item in place at the end of this ArrayList.
+         * @param args must match one of T's constructors.
+         */
+        template<class... Args>
+        void emplace_back(Args&&... args)
+        {
+            _container.emplace(size(), Memory::forward<Args>(args)...);
+        }
+
+        /**
+         * Appends the provided items in order, growing the array once
+         * for the whole batch.
+         * @param items to add, count of them.
+         * @param count number of items.
+         * @return the number of items added.
+         */
+        uint16_t add_range(const T* items, uint16_t count) override
+        {
+            return _container.append_range(items, count);
+        }
+
+        /**
+         * Appends the provided items in order, growing the array once
+         * for the whole batch.
+         * @param items to add, count of them.
+         * @param count number of items.
+         * @return the number of items added.
+         */
+        uint16_t append_range(const T* items, uint16_t count) override
+        {
+            return _container.append_range(items, count);
         }
 
         /**
@@ -69,7 +143,7 @@ namespace Collection
          */
         void remove(const T& item) override
         {
-            _container->remove(item);
+            _container.remove(item);
         }
 
         /**
@@ -79,7 +153,7 @@ namespace Collection
          */
         void remove_at(uint16_t index) override
         {
-            _container->remove_at(index);
+            _container.remove_at(index);
         }
 
         /**
@@ -88,7 +162,7 @@ namespace Collection
          */
         void remove_all(const T& item) override
         {
-            _container->remove_all(item);
+            _container.remove_all(item);
         }
 
         /**
@@ -96,7 +170,7 @@ namespace Collection
          */
         void clear(void) override
         {
-            _container->clear();
+            _container.clear();
         }
 
         /**
@@ -108,7 +182,7 @@ namespace Collection
          */
         T& at(uint16_t index) const override
         {
-            return _container->data_at(index);
+            return _container.data_at(index);
         }
 
         /**
@@ -120,7 +194,7 @@ namespace Collection
          */
         bool contains(const T& item, uint16_t& out_index) const override
         {
-            return _container->contains(item, out_index);
+            return _container.contains(item, out_index);
         }
 
         /**
@@ -128,15 +202,61 @@ namespace Collection
          */
         uint16_t size(void) const override
         {
-            return _container->get_size();
+            return _container.get_size();
+        }
+
+        /**
+         * Grows the array at once so that it holds at least count items.
+         * @param count number of items to make room for.
+         * @return true if there is room for count items, false if the
+         *         array could not grow.
+         */
+        bool reserve(uint16_t count)
+        {
+            return _container.reserve(count);
+        }
+
+        /**
+         * @return the number of items this ArrayList can hold before growing.
+         */
+        uint16_t capacity(void) const
+        {
+            return _container.capacity();
+        }
+
+        /**
+         * Shrinks the array down to the number of items, releasing unused
+         * memory. Following additions grow it again.
+         * @return true if capacity() now equals size(), false otherwise.
+         */
+        bool shrink_to_fit(void)
+        {
+            return _container.shrink_to_fit();
         }
 
     private:
         static const bool ALLOWS_DUPLICATES{ true };
 
-        const Memory::U_ptr<ArrayContainer<T>> _container
-        { 
-            Memory::make_unique<ArrayContainer<T>, UnorderedArrayContainer<T>>(ALLOWS_DUPLICATES)  
-        };
+        UnorderedArrayContainer<T, A, P> _container{ ALLOWS_DUPLICATES };
     };
+
+    /**
+     * ArrayList never allocating: up to N items are stored within the object
+     * itself, and adding fails once it is full.
+     * @param T can be any type as long as it has a default intializer.
+     * @param N maximum number of items.
+     */
+    template<typename T, uint16_t N>
+    using StaticArrayList = ArrayList<T, Memory::InlineStorage<N>>;
+
+    /**
+     * ArrayList storing its first N items within the object itself, and
+     * moving to memory given by A only beyond that. Lists seldom holding
+     * more than N items therefore never allocate.
+     * @param T can be any type as long as it has a default intializer.
+     * @param N number of items stored inline.
+     * @param A allocation policy beyond N items. Memory::HeapAllocator by default.
+     */
+    template<typename T, uint16_t N, typename A = Memory::HeapAllocator>
+    using SmallArrayList = ArrayList<T, Memory::SmallStorage<N, A>>;
 }
\ No newline at end of file
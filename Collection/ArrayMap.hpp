@@ -24,23 +24,30 @@
  */
 #pragma once
 #include "Map.hpp"
+#include "src/OrderedArrayContainer.hpp"
+#include "src/UnorderedArrayContainer.hpp"
 #include <Memory.hpp>
-#include "OrderedSet.hpp"
-#include "ArraySet.hpp"
-#include "Stack.hpp"
 
 namespace Collection
 {
     /**
      * Concrete implementation of Map that uses data array for dynamic memory
-     * allocation. Keys are stored within an ordered set, while values are stored
-     * within an unordered set.
+     * allocation. Keys are stored within an array sorted in ascending order,
+     * and values within a parallel array at the same indices: every operation
+     * runs a single binary search among densely packed keys, then shifts both
+     * arrays at once. Since ArrayMap uses arrays, it also offers access via
+     * index to its entries, in ascending key order.
      * @param TK type of key. Must implement equality and comparison operators.
      *        Most frequently an integer or enumerated type.
      * @param TV can be any type as long as it has a default initializer.
      *        Generally, one should provde smart pointers as such type.
+     * @param A allocation policy for this ArrayMap and its storage
+     *          (see Memory/src/Allocator.hpp), or Memory::InlineStorage<N>
+     *          to store up to N items inline. Memory::HeapAllocator by default.
+     * @param P capacity policy of both arrays, deciding when they grow and
+     *          shrink (see src/CapacityPolicy.hpp). CapacityPolicy<> by default.
      */
-    template<typename TK, typename TV>
+    template<typename TK, typename TV, typename A = Memory::HeapAllocator, typename P = CapacityPolicy<>>
     class ArrayMap : public Map<TK, TV>
     {
     public:
@@ -59,13 +66,50 @@ namespace Collection
          */
         bool add(const TK& key, const TV& value) override
         {
-            if (!_keys->add(key))
+            return insert(key, value);
+        }
+
+        /**
+         * Moves the provided value in with the provided key.
+         * Should fail if key already exists wihtin this ArrayMap.
+         * @param key should be unique.
+         * @param value can be a duplicate or nullptr.
+         * @return true if insertion successful, false otherwise.
+         */
+        bool add(const TK& key, TV&& value)
+        {
+            return insert(key, Memory::move(value));
+        }
+
+        /**
+         * Registers the provided values with the provided keys at once: keys
+         * are sorted, both arrays grow once, then a single backward pass
+         * merges the batch with the stored entries, copying each key and
+         * value once. Keys already present, or repeated within the batch,
+         * keep their first value. Maps that are not heap backed merge by
+         * batches of SortedBatch<A>::MAX_COUNT entries, whose indices are
+         * kept on the stack (see BatchStorage).
+         * @param keys to register, count of them.
+         * @param values to register with the keys at the same indices.
+         * @param count number of entries.
+         * @return the number of entries added.
+         */
+        uint16_t add_range(const TK* keys, const TV* values, uint16_t count)
+        {
+            uint16_t added{ };
+            while (count > 0)
             {
-                return false;
+                auto batch_count = count;
+                if (batch_count > SortedBatch<A>::MAX_COUNT)
+                {
+                    batch_count = SortedBatch<A>::MAX_COUNT;
+                }
+                added += add_batch(keys, values, batch_count);
+                keys += batch_count;
+                values += batch_count;
+                count -= batch_count;
             }
-
-            uint16_t index{ };
-            return _keys->contains(key, index) && _values->add(value, index);
+            return added;
         }
 
         /**
@@ -76,10 +120,10 @@ namespace Collection
         void remove(const TK& key) override
         {
             uint16_t index{ };
-            if (_keys->contains(key, index))
+            if (_keys.contains(key, index))
             {
-                _keys->remove_at(index);
-                _values->remove_at(index);
+                _keys.remove_at(index);
+                _values.remove_at(index);
             }
         }
 
@@ -91,21 +135,15 @@ namespace Collection
          */
         void remove_all(const TV& item) override
         {
-            Stack<uint16_t> indices{ };
-            for (uint16_t index = 0; index < _values->size(); index++)
+            // Backwards, so that removals don't shift indices yet to check.
+            for (auto index = _values.get_size(); index > 0; index--)
             {
-                if (_values->at(index) == item)
+                if (_values.data_at(index - 1) == item)
                 {
-                    indices.push(index);
+                    _keys.remove_at(index - 1);
+                    _values.remove_at(index - 1);
                 }
             }
-
-            while (!indices.is_empty())
-            {
-                auto index = indices.pop();
-                _keys->remove_at(index);
-                _values->remove_at(index);
-            }
         }
 
         /**
@@ -116,13 +154,24 @@ namespace Collection
          */
         bool try_get(const TK& key, TV& out_value) override
         {
-            uint16_t index{ };
-            auto success = _keys->contains(key, index);
-            if (success)
+            auto value = find(key);
+            if (value != nullptr)
             {
-                out_value = _values->at(index);
+                out_value = *value;
             }
-            return success;
+            return value != nullptr;
+        }
+
+        /**
+         * Looks up the value registered at the provided key, without copy.
+         * The address stays valid until this ArrayMap is modified.
+         * @param key to find the item for.
+         * @return the address of the value, nullptr if key not found.
+         */
+        TV* find(const TK& key) const
+        {
+            uint16_t index{ };
+            return _keys.contains(key, index) ? &_values.data_at(index) : nullptr;
         }
 
         /**
@@ -130,7 +179,39 @@ namespace Collection
          */
         uint16_t size(void) const override
         {
-            return _keys->size();
+            return _keys.get_size();
+        }
+
+        /**
+         * Grows both arrays at once so that they hold at least count entries.
+         * @param count number of entries to make room for.
+         * @return true if there is room for count entries, false if the
+         *         arrays could not grow.
+         */
+        bool reserve(uint16_t count)
+        {
+            return _keys.reserve(count) && _values.reserve(count);
+        }
+
+        /**
+         * @return the number of entries this ArrayMap can hold before growing.
+         */
+        uint16_t capacity(void) const
+        {
+            auto keys = _keys.capacity();
+            auto values = _values.capacity();
+            return keys < values ? keys : values;
+        }
+
+        /**
+         * Shrinks both arrays down to the number of entries, releasing
+         * unused memory. Following additions grow them again.
+         * @return true if capacity() now equals size(), false otherwise.
+         */
+        bool shrink_to_fit(void)
+        {
+            auto keys = _keys.shrink_to_fit();
+            return _values.shrink_to_fit() && keys;
         }
 
         /**
@@ -141,7 +222,7 @@ namespace Collection
         bool contains_key(const TK& key) const override
         {
             uint16_t _{};
-            return _keys->contains(key, _);
+            return _keys.contains(key, _);
         }
 
         /**
@@ -153,11 +234,12 @@ namespace Collection
         bool contains(const TV& value) const override
         {
             uint16_t _{ };
-            return _values->contains(value, _);
+            return _values.contains(value, _);
         }
 
         /**
-         * Accesses the KeyValue pair at the specified index.
+         * Accesses the KeyValue pair at the specified index. Both are copied;
+         * prefer key_at() and value_at() in hot paths.
          * CAUTION: ensure index is within bounds, for there are no
          * exceptions on Arduino boards.
          * @param index must be within bounds.
@@ -165,7 +247,32 @@ namespace Collection
          */
         KeyValue<TK, TV> at(uint16_t index) const
         {
-            return { _keys->at(index), _values->at(index) };
+            return { key_at(index), value_at(index) };
+        }
+
+        /**
+         * Accesses the key at the specified index, without copy.
+         * CAUTION: ensure index is within bounds, for there are no
+         * exceptions on Arduino boards.
+         * @param index must be within bounds.
+         * @return the reference to the key at the specified index.
+         */
+        const TK& key_at(uint16_t index) const
+        {
+            return _keys.data_at(index);
+        }
+
+        /**
+         * Accesses the value at the specified index, without copy. Unlike
+         * keys, values can be modified in place.
+         * CAUTION: ensure index is within bounds, for there are no
+         * exceptions on Arduino boards.
+         * @param index must be within bounds.
+         * @return the reference to the value at the specified index.
+         */
+        TV& value_at(uint16_t index) const
+        {
+            return _values.data_at(index);
         }
         
         /**
@@ -174,21 +281,107 @@ namespace Collection
          */
         void clear(void) override
         {
-            _keys->clear();
-            _values->clear();
+            _keys.clear();
+            _values.clear();
         }
 
         KeyValue<TK, TV> operator [](uint16_t index) { return at(index); }
 
     private:
-        const Memory::U_ptr<Collection::OrderedCollection<TK>> _keys
+        static const bool KEYS_ALLOW_DUPLICATES{ false };
+
+        OrderedArrayContainer<TK, A, P> _keys{ SortingOrder::ASCENDING, KEYS_ALLOW_DUPLICATES };
+        UnorderedArrayContainer<TV, A, P> _values{ };
+
+        // One search for both the duplication check and the insertion index.
+        template<typename U>
+        bool insert(const TK& key, U&& value)
+        {
+            uint16_t index{ };
+            if (_keys.contains(key, index) || !_keys.emplace_at(index, key))
+            {
+                return false;
+            }
+
+            // Keep keys and values consistent if values could not grow.
+            if (!_values.emplace(index, Memory::forward<U>(value)))
+            {
+                _keys.remove_at(index);
+                return false;
+            }
+            return true;
+        }
+
+        // Sorts then merges up to SortedBatch<A>::MAX_COUNT entries.
+        uint16_t add_batch(const TK* keys, const TV* values, uint16_t count)
         {
-            Memory::make_unique<Collection::OrderedCollection<TK>, Collection::OrderedSet<TK>>()
-        };
+            auto before = [](const TK& a, const TK& b) { return a < b; };
+            SortedBatch<A> batch{ };
+            if (!batch.sort(keys, count, before))
+            {
+                return add_each(keys, values, count);
+            }
+
+            auto size = _keys.get_size();
+            auto existing_at = [this](uint16_t index) -> const TK& { return _keys.data_at(index); };
+            batch.drop_duplicates(keys, existing_at, size, before);
+            if (!_keys.reserve(size + uint32_t{ batch.size() }) 
+                    || !_values.reserve(size + uint32_t{ batch.size() }))
+            {
+                return add_each(keys, values, count);
+            }
+
+            // Copy the sorted batch at the end, then merge from the greatest
+            // keys down. Batch entries stay in place until a stored one moves.
+            for (uint16_t rank = 0; rank < batch.size(); rank++)
+            {
+                _keys.emplace_at(size + rank, keys[batch[rank]]);
+                _values.emplace(size + rank, values[batch[rank]]);
+            }
+            auto stored = size;
+            auto target = _keys.get_size();
+            for (auto rank = batch.size(); rank > 0; )
+            {
+                auto index = batch[rank - 1];
+                target--;
+                if (size > 0 && keys[index] < _keys.data_at(size - 1))
+                {
+                    size--;
+                    _keys.data_at(target) = Memory::move(_keys.data_at(size));
+                    _values.data_at(target) = Memory::move(_values.data_at(size));
+                }
+                else
+                {
+                    if (size < stored)
+                    {
+                        _keys.data_at(target) = keys[index];
+                        _values.data_at(target) = values[index];
+                    }
+                    rank--;
+                }
+            }
+            return batch.size();
+        }
 
-        const Memory::U_ptr<Collection::UnorderedCollection<TV>> _values
+        // Fallback when the batch cannot be sorted at once.
+        uint16_t add_each(const TK* keys, const TV* values, uint16_t count)
         {
-            Memory::make_unique<Collection::UnorderedCollection<TV>, Collection::ArrayList<TV>>()
-        };
+            uint16_t added{ };
+            for (uint16_t index = 0; index < count; index++)
+            {
+                added += add(keys[index], values[index]);
+            }
+            return added;
+        }
     };
+
+    /**
+     * ArrayMap never allocating: up to N entries are stored within the object
+     * itself, and adding fails once it is full.
+     * @param TK type of key. Must implement equality and comparison operators.
+     * @param TV can be any type.
+     * @param N maximum number of entries.
+     */
+    template<typename TK, typename TV, uint16_t N>
+    using StaticArrayMap = ArrayMap<TK, TV, Memory::InlineStorage<N>>;
 }
\ No newline at end of file
@@ -34,8 +34,13 @@ namespace Collection
      * are not allowed. Memory allocation is based on arrays.
      * @param T can be any type as long as it has a default intializer.
      *          Usually smart pointers.
+     * @param A allocation policy for this ArraySet and its storage
+     *          (see Memory/src/Allocator.hpp), or Memory::InlineStorage<N>
+     *          to store up to N items inline. Memory::HeapAllocator by default.
+     * @param P capacity policy, deciding when the array grows and shrinks
+     *          (see src/CapacityPolicy.hpp). CapacityPolicy<> by default.
      */
-    template <typename T>
+    template<typename T, typename A = Memory::HeapAllocator, typename P = CapacityPolicy<>>
     class ArraySet : public UnorderedCollection<T>
     {
     public:
@@ -50,7 +55,19 @@ namespace Collection
          */
         bool add(const T& item, uint16_t index = 0) override
         {
-            return _container->add(item, index);
+            return _container.add(item, index);
+        }
+
+        /**
+         * Tries to move the provided item in this ArraySet
+         * at the specified index (at the beginning if no index is provided).
+         * @param item to add.
+         * @param index where to add the item. Must be within bounds. 0 by default.
+         * @return true if adding was succesfull, false otherwise.
+         */
+        bool add(T&& item, uint16_t index = 0) override
+        {
+            return _container.add(Memory::move(item), index);
         }
 
         /**
@@ -60,7 +77,41 @@ namespace Collection
          */
         void append(const T& item) override
         {
-            _container->add(item, size());
+            _container.add(item, size());
+        }
+
+        /**
+         * Moves the provided item in at the end of this
+         * ArraySet.
+         * @param item to add.
+         */
+        void append(T&& item) override
+        {
+            _container.add(Memory::move(item), size());
+        }
+
+        /**
+         * Appends the provided items in order, growing the array once
+         * for the whole batch. Items already present are skipped.
+         * @param items to add, count of them.
+         * @param count number of items.
+         * @return the number of items added.
+         */
+        uint16_t add_range(const T* items, uint16_t count) override
+        {
+            return _container.append_range(items, count);
+        }
+
+        /**
+         * Appends the provided items in order, growing the array once
+         * for the whole batch. Items already present are skipped.
+         * @param items to add, count of them.
+         * @param count number of items.
+         * @return the number of items added.
+         */
+        uint16_t append_range(const T* items, uint16_t count) override
+        {
+            return _container.append_range(items, count);
         }
 
         /**
@@ -69,7 +120,7 @@ namespace Collection
          */
         void remove(const T& item) override
         {
-            _container->remove(item);
+            _container.remove(item);
         }
 
         /**
@@ -79,7 +130,7 @@ namespace Collection
          */
         void remove_at(uint16_t index) override
         {
-            _container->remove_at(index);
+            _container.remove_at(index);
         }
 
         /**
@@ -87,7 +138,7 @@ namespace Collection
          */
         void clear(void) override
         {
-            _container->clear();
+            _container.clear();
         }
 
         /**
@@ -99,7 +150,7 @@ namespace Collection
          */
         T& at(uint16_t index) const override
         {
-            return _container->data_at(index);
+            return _container.data_at(index);
         }
 
         /**
@@ -111,7 +162,7 @@ namespace Collection
          */
         bool contains(const T& item, uint16_t& out_index) const override
         {
-            return _container->contains(item, out_index);
+            return _container.contains(item, out_index);
         }
 
         /**
@@ -119,15 +170,50 @@ namespace Collection
          */
         uint16_t size(void) const override
         {
-            return _container->get_size();
+            return _container.get_size();
+        }
+
+        /**
+         * Grows the array at once so that it holds at least count items.
+         * @param count number of items to make room for.
+         * @return true if there is room for count items, false if the
+         *         array could not grow.
+         */
+        bool reserve(uint16_t count)
+        {
+            return _container.reserve(count);
+        }
+
+        /**
+         * @return the number of items this ArraySet can hold before growing.
+         */
+        uint16_t capacity(void) const
+        {
+            return _container.capacity();
+        }
+
+        /**
+         * Shrinks the array down to the number of items, releasing unused
+         * memory. Following additions grow it again.
+         * @return true if capacity() now equals size(), false otherwise.
+         */
+        bool shrink_to_fit(void)
+        {
+            return _container.shrink_to_fit();
         }
 
     private:
         static const bool ALLOWS_DUPLICATES{ false };
 
-        const Memory::U_ptr<ArrayContainer<T>> _container
-        { 
-            Memory::make_unique<ArrayContainer<T>, UnorderedArrayContainer<T>>(ALLOWS_DUPLICATES)  
-        };
+        UnorderedArrayContainer<T, A, P> _container{ ALLOWS_DUPLICATES };
     };
+
+    /**
+     * ArraySet never allocating: up to N items are stored within the object
+     * itself, and adding fails once it is full.
+     * @param T can be any type.
+     * @param N maximum number of items.
+     */
+    template<typename T, uint16_t N>
+    using StaticArraySet = ArraySet<T, Memory::InlineStorage<N>>;
 }
\ No newline at end of file
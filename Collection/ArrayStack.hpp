@@ -0,0 +1,272 @@
+/*
+ * ----------------------------------------------------------------------------
+ * ArrayStack
+ * Last in, first out collection stored within a contiguous array.
+ * Part of the ArduinoLibraries project, to be used with any Arduino board.
+ * <https://github.com/Pierrolefou881/ArduinoLibraries>
+ * ----------------------------------------------------------------------------
+ *
+ * Copyright (C) 2025  Pierre DEBAS
+ * <dpierre394@gmail.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#pragma once
+#include "ProcessingCollection.hpp"
+#include "src/CapacityPolicy.hpp"
+#include <Memory.hpp>
+#include <stdint.h>
+
+namespace Collection
+{
+    // Forward declaration
+    template<typename T, typename A, typename P>
+    class ArrayStack;
+
+    /**
+     * Iterates over ArrayStacks from top to bottom.
+     * @param T type of element contained in the ArrayStack.
+     * @param A storage policy of the ArrayStack.
+     * @param P capacity policy of the ArrayStack.
+     */
+    template<typename T, typename A = Memory::HeapAllocator, typename P = NeverShrink<4>>
+    class ArrayStackIterator : public BaseIterator<T>
+    {
+    public:
+        /**
+         * Initializes this ArrayStackIterator on the top of the provided
+         * ArrayStack.
+         */
+        ArrayStackIterator(ArrayStack<T, A, P>* stack) 
+            : _stack{ stack }
+            , _remaining{ stack->size() }
+        {
+            // Empty body.
+        }
+
+        virtual ~ArrayStackIterator(void) = default;
+
+        /**
+         * @return true if there is at least one element remaining to iterate
+         *         over, false otherwise.
+         */
+        bool has_next(void) const override
+        {
+            return _remaining > 0;
+        }
+
+        /**
+         * @return the element currently iterated over.
+         */
+        T& get(void) const override
+        {
+            return _stack->_data[_remaining - 1];
+        }
+
+        /**
+         * Moves to the next element.
+         */
+        void next(void) override
+        {
+            _remaining--;
+        }
+
+    private:
+        ArrayStack<T, A, P>* _stack{ };
+        uint16_t _remaining{ };
+    };
+
+    /**
+     * Last in, first out ProcessingCollection storing its elements within
+     * a contiguous array, top last: push, pop, peek and size run in
+     * constant time, without recursion nor allocation as long as there
+     * is room left. When full, the array doubles its capacity. By default,
+     * popping and clearing keep the array, so that the ArrayStack can be
+     * reused as scratch space without allocating again.
+     * @param T can be any data type. Must have a default constructor.
+     * @param A allocation policy for the array (see Memory/src/Allocator.hpp),
+     *          or Memory::InlineStorage<N> to hold at most N elements within
+     *          the ArrayStack itself. Memory::HeapAllocator by default.
+     * @param P capacity policy, deciding when the array grows and shrinks
+     *          (see src/CapacityPolicy.hpp). NeverShrink<4> by default.
+     */
+    template<typename T, typename A = Memory::HeapAllocator, typename P = NeverShrink<4>>
+    class ArrayStack : public ProcessingCollection<T>
+    {
+    public:
+        /**
+         * Initializes this ArrayStack as an empty collection. Nothing is
+         * allocated until the first item is pushed.
+         */
+        ArrayStack(void) = default;
+
+        ArrayStack(const ArrayStack&) = delete;
+        ArrayStack& operator =(const ArrayStack&) = delete;
+
+        virtual ~ArrayStack(void) = default;
+
+        /**
+         * Adds the provided item on top of this ArrayStack.
+         * @param item to add.
+         */
+        void push(const T& item) override
+        {
+            emplace(item);
+        }
+
+        /**
+         * Moves the provided item in on top of this ArrayStack.
+         * @param item to add.
+         */
+        void push(T&& item) override
+        {
+            emplace(Memory::move(item));
+        }
+
+        /**
+         * Constructs an item in place on top of this ArrayStack. The item
+         * is dropped if the array is full and can't grow.
+         * @param args must match one of T's constructors.
+         * @return true if the item was added, false otherwise.
+         */
+        template<class... Args>
+        bool emplace(Args&&... args)
+        {
+            auto size = _data.size();
+            return reserve(size + 1) && _data.emplace(size, Memory::forward<Args>(args)...);
+        }
+
+        /**
+         * Removes the top element and moves it out.
+         * @return the top element, a default T if this ArrayStack is empty.
+         */
+        T pop(void) override
+        {
+            if (is_empty())
+            {
+                return { };
+            }
+            auto top = _data.size() - 1;
+            auto ret_val = Memory::move(_data[top]);
+            _data.erase(top);
+            manage_capacity();
+            return ret_val;
+        }
+
+        /**
+         * Accesses the top element without removing it.
+         * CAUTION: this ArrayStack must not be empty.
+         * @return the reference to the top element.
+         */
+        T& peek(void) const override
+        {
+            return _data[_data.size() - 1];
+        }
+
+        /**
+         * Removes all elements from this ArrayStack. The array is kept,
+         * unless P shrinks it.
+         */
+        void clear(void) override
+        {
+            _data.clear();
+            manage_capacity();
+        }
+
+        /**
+         * @return true if this ArrayStack has no element, false otherwise.
+         */
+        bool is_empty(void) const override
+        {
+            return _data.size() == 0;
+        }
+
+        /**
+         * @return the number of elements in this ArrayStack.
+         */
+        uint16_t size(void) const override
+        {
+            return _data.size();
+        }
+
+        /**
+         * @return the number of elements this ArrayStack can hold before
+         *         growing.
+         */
+        uint16_t capacity(void) const
+        {
+            return _data.capacity();
+        }
+
+        /**
+         * Grows the array at once so that it holds at least count elements.
+         * @param count number of elements to make room for.
+         * @return true if there is room for count elements, false if the
+         *         array could not grow.
+         */
+        bool reserve(uint16_t count)
+        {
+            auto current = _data.capacity();
+            if (count <= current)
+            {
+                return true;
+            }
+            auto new_capacity = P::grow(current, count);
+            if (new_capacity > MAX_CAPACITY)
+            {
+                new_capacity = MAX_CAPACITY;
+            }
+            return _data.reallocate(new_capacity) || _data.reallocate(count);
+        }
+
+        /**
+         * Shrinks the array down to the number of elements, releasing unused
+         * memory. Following pushes grow it again.
+         * @return true if capacity() now equals size(), false otherwise.
+         */
+        bool shrink_to_fit(void)
+        {
+            return _data.reallocate(_data.size());
+        }
+
+        /**
+         * Iterators are short lived: allocated within the active
+         * Memory::ArenaScope, if any, upon the heap otherwise.
+         * @return a new instance of ArrayStackIterator for this ArrayStack,
+         *         from top to bottom.
+         */
+        Memory::U_ptr<BaseIterator<T>, Memory::ArenaDelete<BaseIterator<T>>> create_iterator(void) const override
+        {
+            return Memory::make_scoped<BaseIterator<T>, ArrayStackIterator<T, A, P>>((ArrayStack<T, A, P>*) this);
+        }
+
+        friend class ArrayStackIterator<T, A, P>;
+
+    private:
+        static const uint16_t MAX_CAPACITY{ 0xFFFF };
+
+        typename Memory::ArrayStorage<T, A>::type _data{ };
+
+        // Shrinks the array once P deems it empty enough.
+        void manage_capacity(void)
+        {
+            auto capacity = _data.capacity();
+            auto new_capacity = P::shrink(capacity, _data.size());
+            if (new_capacity < capacity)
+            {
+                _data.reallocate(new_capacity);
+            }
+        }
+    };
+}
\ No newline at end of file
@@ -0,0 +1,219 @@
+/*
+ * ----------------------------------------------------------------------------
+ * HashMap
+ * Map based on open addressing hash table.
+ * Part of the ArduinoLibraries project, to be used with any Arduino board.
+ * <https://github.com/Pierrolefou881/ArduinoLibraries>
+ * ----------------------------------------------------------------------------
+ *
+ * Copyright (C) 2025  Pierre DEBAS
+ * <dpierre394@gmail.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#pragma once
+#include "Map.hpp"
+#include "src/HashTable.hpp"
+#include <Memory.hpp>
+
+namespace Collection
+{
+    /**
+     * Concrete implementation of Map storing its entries within a Robin Hood
+     * hash table: adding, removing and looking up keys take constant time on
+     * average, whatever the number of entries, where ArrayMap needs a binary
+     * search plus shifting. Entries are kept in no particular order.
+     * @param TK type of key. Must implement the equality operator.
+     *        Most frequently an integer or enumerated type.
+     * @param TV can be any type as long as it is movable.
+     * @param H hash functor returning 32 bits for a key. Collection::Hash<TK>
+     *          by default, defined for integral, enumerated and pointer types.
+     * @param A allocation policy for the table (see Memory/src/Allocator.hpp).
+     *          Memory::HeapAllocator by default.
+     */
+    template<typename TK, typename TV, typename H = Hash<TK>, typename A = Memory::HeapAllocator>
+    class HashMap : public Map<TK, TV>
+    {
+    public:
+        /**
+         * Initializes this HashMap as an empty map. Nothing is allocated
+         * until the first entry is added.
+         */
+        HashMap(void) = default;
+        virtual ~HashMap(void) = default;
+
+        /**
+         * Registers the provided value with the provided key.
+         * Fails if key already exists wihtin this HashMap.
+         * @param key should be unique.
+         * @param value can be a duplicate or nullptr.
+         * @return true if insertion successful, false otherwise.
+         */
+        bool add(const TK& key, const TV& value) override
+        {
+            return !contains_key(key) && _table.insert(Entry{ key, value });
+        }
+
+        /**
+         * Moves the provided value in with the provided key.
+         * Fails if key already exists wihtin this HashMap.
+         * @param key should be unique.
+         * @param value can be a duplicate or nullptr.
+         * @return true if insertion successful, false otherwise.
+         */
+        bool add(const TK& key, TV&& value)
+        {
+            return !contains_key(key) && _table.insert(Entry{ key, Memory::move(value) });
+        }
+
+        /**
+         * Removes the value registered at the provided key.
+         * Does nothing if key not found.
+         * @param key indexing the item to remove.
+         */
+        void remove(const TK& key) override
+        {
+            _table.erase(key);
+        }
+
+        /**
+         * Unregisters and removes all instances of the provided
+         * item from this HashMap. Does nothing if said item is not
+         * present.
+         * @param item to remove.
+         */
+        void remove_all(const TV& item) override
+        {
+            _table.erase_if([&item](const Entry& entry) { return entry.value == item; });
+        }
+
+        /**
+         * Tries to retrieve the item registered at the provided key.
+         * @param key to find the item for.
+         * @param out_value out parameter for retrieved value.
+         * @return true if item found, false otherwise.
+         */
+        bool try_get(const TK& key, TV& out_value) override
+        {
+            auto value = find(key);
+            if (value != nullptr)
+            {
+                out_value = *value;
+            }
+            return value != nullptr;
+        }
+
+        /**
+         * Looks up the value registered at the provided key, without copy.
+         * The address stays valid until this HashMap is modified.
+         * @param key to find the item for.
+         * @return the address of the value, nullptr if key not found.
+         */
+        TV* find(const TK& key) const
+        {
+            auto entry = _table.find(key);
+            return entry == nullptr ? nullptr : &entry->value;
+        }
+
+        /**
+         * @return the number of elements contained in this Map.
+         */
+        uint16_t size(void) const override
+        {
+            return _table.size();
+        }
+
+        /**
+         * Grows the table at once so that it holds at least count entries.
+         * @param count number of entries to make room for.
+         * @return true if there is room for count entries, false if the
+         *         table could not grow.
+         */
+        bool reserve(uint16_t count)
+        {
+            return _table.reserve(count);
+        }
+
+        /**
+         * @return the number of entries this HashMap can hold before growing.
+         */
+        uint16_t capacity(void) const
+        {
+            return _table.capacity();
+        }
+
+        /**
+         * Shrinks the table down to the fewest slots holding the entries,
+         * releasing it when empty. Following additions grow it again.
+         * @return true if the table now fits the entries, false otherwise.
+         */
+        bool shrink_to_fit(void)
+        {
+            return _table.shrink_to_fit();
+        }
+
+        /**
+         * Determines whether a provided key is in use within this Map.
+         * @param key to check the presence of.
+         * @return true if key found used in this Map, false otherwise.
+         */
+        bool contains_key(const TK& key) const override
+        {
+            return _table.find(key) != nullptr;
+        }
+
+        /**
+         * Checks whether the provided value is present in this Map.
+         * Walks through the whole table.
+         * @param value to check the presence of.
+         * @return true if at least one instance of value is present
+         *         in this Map, false otherwise.
+         */
+        bool contains(const TV& value) const override
+        {
+            auto count = _table.slot_count();
+            for (uint32_t slot = 0; slot < count; slot++)
+            {
+                auto entry = _table.at_slot(slot);
+                if (entry != nullptr && entry->value == value)
+                {
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        /**
+         * Removes all elements from this Map. The table is kept.
+         */
+        void clear(void) override
+        {
+            _table.clear();
+        }
+
+    private:
+        struct Entry
+        {
+            TK key;
+            TV value;
+        };
+
+        struct KeyOf
+        {
+            const TK& operator ()(const Entry& entry) const { return entry.key; }
+        };
+
+        HashTable<Entry, TK, KeyOf, H, A> _table{ };
+    };
+}
\ No newline at end of file
@@ -0,0 +1,327 @@
+/*
+ * ----------------------------------------------------------------------------
+ * HashSet
+ * Unordered set based on open addressing hash table.
+ * Part of the ArduinoLibraries project, to be used with any Arduino board.
+ * <https://github.com/Pierrolefou881/ArduinoLibraries>
+ * ----------------------------------------------------------------------------
+ *
+ * Copyright (C) 2025  Pierre DEBAS
+ * <dpierre394@gmail.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#pragma once
+#include "UnorderedCollection.hpp"
+#include "Iterable.hpp"
+#include "src/HashTable.hpp"
+#include <Memory.hpp>
+
+namespace Collection
+{
+    // Forward declaration
+    template<typename T, typename H, typename A>
+    class HashSet;
+
+    /**
+     * Iterates over HashSets in storage order.
+     * @param T type of element contained in the HashSet.
+     * @param H hash functor of the HashSet.
+     * @param A allocation policy of the HashSet.
+     */
+    template<typename T, typename H = Hash<T>, typename A = Memory::HeapAllocator>
+    class HashSetIterator : public BaseIterator<T>
+    {
+    public:
+        /**
+         * Initializes this HashSetIterator on the first element of the
+         * provided HashSet.
+         */
+        HashSetIterator(HashSet<T, H, A>* set) : _set{ set }
+        {
+            skip_empty();
+        }
+
+        virtual ~HashSetIterator(void) = default;
+
+        /**
+         * @return true if there is at least one element remaining to iterate
+         *         over, false otherwise.
+         */
+        bool has_next(void) const override
+        {
+            return _slot < _set->_table.slot_count();
+        }
+
+        /**
+         * @return the element currently iterated over.
+         */
+        T& get(void) const override
+        {
+            return *_set->_table.at_slot(_slot);
+        }
+
+        /**
+         * Moves to the next element.
+         */
+        void next(void) override
+        {
+            _slot++;
+            skip_empty();
+        }
+
+    private:
+        HashSet<T, H, A>* _set{ };
+        uint32_t _slot{ };
+
+        void skip_empty(void)
+        {
+            while (has_next() && _set->_table.at_slot(_slot) == nullptr)
+            {
+                _slot++;
+            }
+        }
+    };
+
+    /**
+     * Unordered set of objects, stored within a Robin Hood hash table:
+     * adding, removing and looking up items take constant time on average,
+     * whatever the number of items. Duplicates are not allowed, and items
+     * have no stable position: indices given by contains() and used by at()
+     * and remove_at() follow storage order, and cost a walk through the table.
+     * Prefer iterators, or contains(item), to go over or look for items.
+     * @param T must implement the equality operator and be movable.
+     * @param H hash functor returning 32 bits for an item. Collection::Hash<T>
+     *          by default, defined for integral, enumerated and pointer types.
+     * @param A allocation policy for the table (see Memory/src/Allocator.hpp).
+     *          Memory::HeapAllocator by default.
+     */
+    template<typename T, typename H = Hash<T>, typename A = Memory::HeapAllocator>
+    class HashSet : public UnorderedCollection<T>, public Iterable<T>
+    {
+    public:
+        virtual ~HashSet(void) = default;
+
+        /**
+         * Tries to add the provided item to this HashSet. Fails if
+         * the item is already present.
+         * @param item to add.
+         * @param index unused, items have no chosen position.
+         * @return true if adding was succesfull, false otherwise.
+         */
+        bool add(const T& item, uint16_t = 0) override
+        {
+            return add(T{ item });
+        }
+
+        /**
+         * Tries to move the provided item in this HashSet. Fails if
+         * the item is already present.
+         * @param item to add.
+         * @param index unused, items have no chosen position.
+         * @return true if adding was succesfull, false otherwise.
+         */
+        bool add(T&& item, uint16_t = 0) override
+        {
+            return !contains(item) && _table.insert(Memory::move(item));
+        }
+
+        /**
+         * Adds the provided item to this HashSet, if not already present.
+         * @param item to add.
+         */
+        void append(const T& item) override
+        {
+            add(item);
+        }
+
+        /**
+         * Moves the provided item in this HashSet, if not already present.
+         * @param item to add.
+         */
+        void append(T&& item) override
+        {
+            add(Memory::move(item));
+        }
+
+        /**
+         * Adds the provided items, growing the table once for the whole batch.
+         * Items already present are skipped.
+         * @param items to add, count of them.
+         * @param count number of items.
+         * @return the number of items added.
+         */
+        uint16_t add_range(const T* items, uint16_t count) override
+        {
+            // Best effort: if the whole batch does not fit, add what fits.
+            _table.reserve(size() + uint32_t{ count });
+            uint16_t added{ };
+            for (uint16_t index = 0; index < count; index++)
+            {
+                added += add(items[index]);
+            }
+            return added;
+        }
+
+        /**
+         * Adds the provided items, growing the table once for the whole batch.
+         * Items already present are skipped.
+         * @param items to add, count of them.
+         * @param count number of items.
+         * @return the number of items added.
+         */
+        uint16_t append_range(const T* items, uint16_t count) override
+        {
+            return add_range(items, count);
+        }
+
+        /**
+         * Removes the provided item, if present.
+         * @param item to remove.
+         */
+        void remove(const T& item) override
+        {
+            _table.erase(item);
+        }
+
+        /**
+         * Removes the item at the specified position in storage order.
+         * Does nothing if index is out of bounds.
+         * @param index of the item to remove.
+         */
+        void remove_at(uint16_t index) override
+        {
+            if (index < size())
+            {
+                _table.erase(T{ at(index) });
+            }
+        }
+
+        /**
+         * Removes all items from this HashSet. The table is kept.
+         */
+        void clear(void) override
+        {
+            _table.clear();
+        }
+
+        /**
+         * Access the element at the given position in storage order.
+         * CAUTION: ensure index is within bounds; there are no exceptions
+         *          on Arduino platform.
+         * @param index must be wihtin bounds.
+         * @return the reference to the item at the given position.
+         */
+        T& at(uint16_t index) const override
+        {
+            uint32_t slot{ };
+            for (;; slot++)
+            {
+                if (_table.at_slot(slot) != nullptr && index-- == 0)
+                {
+                    return *_table.at_slot(slot);
+                }
+            }
+        }
+
+        /**
+         * Checks the presence of a given item within this HashSet.
+         * @param item to check.
+         * @param out_index of the item in storage order, if found. Out parameter.
+         * @return true if item is present within this HashSet,
+         *         false otherwise.
+         */
+        bool contains(const T& item, uint16_t& out_index) const override
+        {
+            auto found = _table.find(item);
+            if (found == nullptr)
+            {
+                return false;
+            }
+            out_index = 0;
+            for (uint32_t slot = 0; _table.at_slot(slot) != found; slot++)
+            {
+                out_index += _table.at_slot(slot) != nullptr;
+            }
+            return true;
+        }
+
+        /**
+         * Checks the presence of a given item within this HashSet,
+         * in constant time on average.
+         * @param item to check.
+         * @return true if item is present within this HashSet,
+         *         false otherwise.
+         */
+        bool contains(const T& item) const
+        {
+            return _table.find(item) != nullptr;
+        }
+
+        /**
+         * @return the number of elements contained in this HashSet.
+         */
+        uint16_t size(void) const override
+        {
+            return _table.size();
+        }
+
+        /**
+         * Grows the table at once so that it holds at least count items.
+         * @param count number of items to make room for.
+         * @return true if there is room for count items, false if the
+         *         table could not grow.
+         */
+        bool reserve(uint16_t count)
+        {
+            return _table.reserve(count);
+        }
+
+        /**
+         * @return the number of items this HashSet can hold before growing.
+         */
+        uint16_t capacity(void) const
+        {
+            return _table.capacity();
+        }
+
+        /**
+         * Shrinks the table down to the fewest slots holding the items,
+         * releasing it when empty. Following additions grow it again.
+         * @return true if the table now fits the items, false otherwise.
+         */
+        bool shrink_to_fit(void)
+        {
+            return _table.shrink_to_fit();
+        }
+
+        /**
+         * @return a new HashSetIterator on this HashSet.
+         */
+        Memory::U_ptr<BaseIterator<T>, Memory::ArenaDelete<BaseIterator<T>>> create_iterator(void) const override
+        {
+            return Memory::make_scoped<BaseIterator<T>, HashSetIterator<T, H, A>>((HashSet<T, H, A>*) this);
+        }
+
+        friend class HashSetIterator<T, H, A>;
+
+    private:
+        struct Identity
+        {
+            const T& operator ()(const T& item) const { return item; }
+        };
+
+        HashTable<T, T, Identity, H, A> _table{ };
+    };
+}
\ No newline at end of file
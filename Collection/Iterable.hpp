@@ -42,6 +42,6 @@ namespace Collection
         /**
          * @return a new instance of BaseIterator for this Iterable.
          */
-        virtual Memory::U_ptr<BaseIterator<T>> create_iterator(void) const = 0;
+        virtual Memory::U_ptr<BaseIterator<T>, Memory::ArenaDelete<BaseIterator<T>>> create_iterator(void) const = 0;
     };
 }
\ No newline at end of file
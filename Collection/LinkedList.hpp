@@ -26,19 +26,21 @@
 #include "UnorderedList.hpp"
 #include <Memory.hpp>
 #include "Iterable.hpp"
+#include "src/LinkedNode.hpp"
 
 namespace Collection
 {
     // Forward declaration
-    template<typename T>
+    template<typename T, typename A>
     class LinkedList;
 
     /**
      * Iterates over LinkedLists without exposing inner algorithms.
      * @param T type conained witin the LinkedList. Must have a default
      *        constructor.
+     * @param A allocation policy of the LinkedList.
      */
-    template<typename T>
+    template<typename T, typename A = Memory::HeapAllocator>
     class LinkedListIterator : public BaseIterator<T>
     {
     public:
@@ -47,7 +49,7 @@ namespace Collection
          * to iterate over.
          * @param list must not be nullptr.
          */
-        LinkedListIterator(LinkedList<T>* list) : _list{ list }
+        LinkedListIterator(LinkedList<T, A>* list) : _node{ list->_head }
         {
             // Empty body.
         }
@@ -60,7 +62,7 @@ namespace Collection
          */
         bool has_next(void) const override
         {
-            return _list->_next != nullptr;
+            return _node != nullptr;
         }
 
         /**
@@ -68,7 +70,7 @@ namespace Collection
          */
         T& get(void) const override
         {
-            return _list->_next->_data;
+            return _node->data;
         }
 
         /**
@@ -76,19 +78,26 @@ namespace Collection
          */
         void next(void) override
         {
-            _list = _list->_next.get();
+            _node = _node->next;
         }
 
     private:
-        LinkedList<T>* _list{ };
+        LinkedNode<T>* _node{ };
     };
 
     /**
-     * Dynamic sized linked list of objects.
+     * Dynamic sized linked list of objects. The LinkedList holds the first
+     * and last links and the size; each link is a plain LinkedNode holding
+     * only its item and the next link, created with A. Algorithms walk the
+     * links iteratively, so that stack use does not depend on the length
+     * of the list, and appending runs in constant time. A LinkedList owns
+     * its links, so it can't be copied.
      * @param T can be any type as long as it has a default initializer.
      *          Usually smart pointers.
+     * @param A allocation policy for links (see Memory/src/Allocator.hpp).
+     *          Memory::HeapAllocator by default.
      */
-    template<typename T>
+    template<typename T, typename A = Memory::HeapAllocator>
     class LinkedList : public UnorderedList<T>, public Iterable<T>
     {
     public:
@@ -96,7 +105,14 @@ namespace Collection
          * Initializes this LinkedList as an empty list.
          */
         LinkedList(void) = default;
-        virtual ~LinkedList(void) = default;
+
+        LinkedList(const LinkedList&) = delete;
+        LinkedList& operator =(const LinkedList&) = delete;
+
+        virtual ~LinkedList(void)
+        {
+            clear();
+        }
 
         /**
          * Tries to add the provided item to this LinkedList and
@@ -107,13 +123,36 @@ namespace Collection
          */
         bool add(const T& item, uint16_t index = 0) override
         {
-            if (index > *_current_size)
+            return emplace(index, item);
+        }
+
+        /**
+         * Tries to move the provided item in this LinkedList
+         * at the specified index (at the beginning if no index is provided).
+         * @param item to add.
+         * @param index where to add the item. Must be within bounds. 0 by default.
+         * @return true if adding was succesfull, false otherwise.
+         */
+        bool add(T&& item, uint16_t index = 0) override
+        {
+            return emplace(index, Memory::move(item));
+        }
+
+        /**
+         * Tries to construct an item in place at the specified index.
+         * @param index where to add the item. Must be within bounds.
+         * @param args must match one of T's constructors.
+         * @return true if adding was succesfull, false otherwise.
+         */
+        template<class... Args>
+        bool emplace(uint16_t index, Args&&... args)
+        {
+            if (index > _size)
             {
-              return false;
+                return false;
             }
 
-            add_recursive(item, index, 0);
-            return true;
+            return insert_after(index == 0 ? nullptr : access_node(index - 1), Memory::forward<Args>(args)...);
         }
 
         /**
@@ -123,15 +162,38 @@ namespace Collection
          */
         void append(const T& item) override
         {
-            if (_next == nullptr)
-            {
-                _next = new LinkedList<T>{ item, _current_size };
-                (*_current_size)++;
-            }
-            else 
-            {
-                _next->append(item);
-            }
+            emplace_back(item);
+        }
+
+        /**
+         * Moves the provided item in at the end of this
+         * LinkedList.
+         * @param item to add.
+         */
+        void append(T&& item) override
+        {
+            emplace_back(Memory::move(item));
+        }
+
+        /**
+         * Constructs an item in place at the end of this LinkedList.
+         * @param args must match one of T's constructors.
+         */
+        template<class... Args>
+        void emplace_back(Args&&... args)
+        {
+            insert_after(_last, Memory::forward<Args>(args)...);
+        }
+
+        /**
+         * Appends the provided items in order, each in constant time.
+         * @param items to add, count of them.
+         * @param count number of items.
+         * @return the number of items added.
+         */
+        uint16_t add_range(const T* items, uint16_t count) override
+        {
+            return UnorderedList<T>::append_range(items, count);
         }
 
         /**
@@ -140,17 +202,16 @@ namespace Collection
          */
         void remove(const T& item) override
         {
-            if (_next == nullptr)
-            {
-                return;
-            }
-
-            if (item == _next->_data)
+            LinkedNode<T>* previous{ };
+            for (auto node = _head; node != nullptr; node = node->next)
             {
-                remove_link();
-                return;
+                if (item == node->data)
+                {
+                    remove_after(previous);
+                    return;
+                }
+                previous = node;
             }
-            _next->remove(item);
         }
 
         /**
@@ -160,13 +221,12 @@ namespace Collection
          */
         void remove_at(uint16_t index) override
         {
-            if (index >= *_current_size)
+            if (index >= _size)
             {
                 return;
             }
 
-            auto to_delete = access_link(index, 0);
-            to_delete->remove_link();
+            remove_after(index == 0 ? nullptr : access_node(index - 1));
         }
 
         /**
@@ -175,19 +235,20 @@ namespace Collection
          */
         void remove_all(const T& item) override
         {
-            if (_next == nullptr)
+            LinkedNode<T>* previous{ };
+            auto node = _head;
+            while (node != nullptr)
             {
-                return;
-            }
-
-            if (item == _next->_data)
-            {
-                remove_link();
-                remove_all(item);   // re-run to avoid jumping links.
-            }
-            else
-            {
-                _next->remove_all(item);
+                auto next = node->next;
+                if (item == node->data)
+                {
+                    remove_after(previous);     // previous stays put.
+                }
+                else
+                {
+                    previous = node;
+                }
+                node = next;
             }
         }
 
@@ -196,8 +257,10 @@ namespace Collection
          */
         void clear(void) override
         {
-            _next = nullptr;
-            *_current_size = 0;
+            while (_head != nullptr)
+            {
+                remove_after(nullptr);
+            }
         }
 
         /**
@@ -209,7 +272,7 @@ namespace Collection
          */
         T& at(uint16_t index) const override
         {
-            return access_link(index, 0)->_next->_data;
+            return access_node(index)->data;
         }
 
         /**
@@ -221,7 +284,17 @@ namespace Collection
          */
         bool contains(const T& item, uint16_t& out_index = 0) const override
         {
-            return _next != nullptr && (_next->_data == item || _next->contains(item, ++out_index));
+            uint16_t index{ };
+            for (auto node = _head; node != nullptr; node = node->next)
+            {
+                if (node->data == item)
+                {
+                    out_index = index;
+                    return true;
+                }
+                index++;
+            }
+            return false;
         }
 
         /**
@@ -229,58 +302,70 @@ namespace Collection
          */
         uint16_t size(void) const override 
         { 
-            return *_current_size;
+            return _size;
         }
 
         /**
+         * Iterators are short lived: allocated within the active
+         * Memory::ArenaScope, if any, upon the heap otherwise.
          * @return a new instance of BaseIterator for this LinkedList.
          */
-        Memory::U_ptr<BaseIterator<T>> create_iterator(void) const override
+        Memory::U_ptr<BaseIterator<T>, Memory::ArenaDelete<BaseIterator<T>>> create_iterator(void) const override
         {
-            return Memory::make_unique<BaseIterator<T>, LinkedListIterator<T>>((LinkedList<T>*) this);
+            return Memory::make_scoped<BaseIterator<T>, LinkedListIterator<T, A>>((LinkedList<T, A>*) this);
         }
 
-        friend class LinkedListIterator<T>;
+        friend class LinkedListIterator<T, A>;
 
     private:
-        T _data{ };
-        Memory::S_ptr<LinkedList<T>> _next{ };
-        Memory::S_ptr<uint16_t> _current_size{ Memory::make_shared<uint16_t>() };
-
-        // Link insertion Ctor.
-        LinkedList(const T& item, const Memory::S_ptr<uint16_t>& current_size)
-            : _data{ item }
-            , _next{ }
-            , _current_size{ current_size }
-        {
-            // Empty body
-        }
+        LinkedNode<T>* _head{ };
+        LinkedNode<T>* _last{ };
+        uint16_t _size{ };
 
-        void add_recursive(const T& item, uint16_t target_index, uint16_t current_index)
+        // Links a new node after previous, or first if previous is nullptr.
+        template<class... Args>
+        bool insert_after(LinkedNode<T>* previous, Args&&... args)
         {
-            if (current_index == target_index)
+            auto node = Memory::create<LinkedNode<T>, A>(Memory::forward<Args>(args)...);
+            if (node == nullptr)
             {
-                auto tmp = _next;
-                _next = new LinkedList<T>{ item, _current_size };
-                _next->_next = tmp;
-                (*_current_size)++;
+                return false;
             }
-            else 
+            auto& slot = previous == nullptr ? _head : previous->next;
+            node->next = slot;
+            slot = node;
+            if (node->next == nullptr)
             {
-                _next->add_recursive(item, target_index, current_index + 1);
+                _last = node;
             }
+            _size++;
+            return true;
         }
 
-        LinkedList<T>* access_link(uint16_t target_index, uint16_t current_index) const
+        // Unlinks and destroys the node after previous, or the first one if
+        // previous is nullptr. That node must exist.
+        void remove_after(LinkedNode<T>* previous)
         {
-            return current_index == target_index ? (LinkedList<T>*) this : _next->access_link(target_index, current_index + 1);
+            auto& slot = previous == nullptr ? _head : previous->next;
+            auto node = slot;
+            slot = node->next;
+            if (node == _last)
+            {
+                _last = previous;
+            }
+            Memory::AllocatorDelete<A, LinkedNode<T>>{ }(node);
+            _size--;
         }
 
-        void remove_link(void)
+        // Node at index, which must be within bounds.
+        LinkedNode<T>* access_node(uint16_t index) const
         {
-            auto tmp = _next->_next;
-            _next = tmp;
-            (*_current_size)--;
+            auto node = _head;
+            for (uint16_t current_index = 0; current_index < index; current_index++)
+            {
+                node = node->next;
+            }
+            return node;
         }
     };
 }
\ No newline at end of file
@@ -31,19 +31,20 @@
 namespace Collection
 {
     // Forward declaration.
-    template<typename T>
+    template<typename T, typename A>
     class LinkedSet;
 
     /**
      * Iterates over LinkedSets without exposing inner algorithms.
      * @param T type conained witin the LinkedSet. Must have a default
      *          Constructor.
+     * @param A allocation policy of the LinkedSet.
      */
-    template<typename T>
+    template<typename T, typename A = Memory::HeapAllocator>
     class LinkedSetIterator : public BaseIterator<T>
     {
     public:
-        LinkedSetIterator(LinkedSet<T>* set) : _wrapped_iterator{ set->_list->create_iterator() }
+        LinkedSetIterator(LinkedSet<T, A>* set) : _wrapped_iterator{ set->_list.create_iterator() }
         {
             // Empty body
         }
@@ -76,7 +77,7 @@ namespace Collection
         }
 
     private:
-        Memory::U_ptr<BaseIterator<T>> _wrapped_iterator{ };
+        Memory::U_ptr<BaseIterator<T>, Memory::ArenaDelete<BaseIterator<T>>> _wrapped_iterator{ };
     };
     
     /**
@@ -84,8 +85,10 @@ namespace Collection
      * adding duplicates.
      * @param T can be any type as long as it has a default initializer.
      *          Usually smart pointers.
+     * @param A allocation policy for links (see Memory/src/Allocator.hpp).
+     *          Memory::HeapAllocator by default.
      */
-    template<typename T>
+    template<typename T, typename A = Memory::HeapAllocator>
     class LinkedSet : public UnorderedCollection<T>, public Iterable<T>
     {
     public:
@@ -101,7 +104,20 @@ namespace Collection
         bool add(const T& item, uint16_t index = 0) override
         {
             uint16_t _{};
-            return !contains(item, _) && _list->add(item, index);
+            return !contains(item, _) && _list.add(item, index);
+        }
+
+        /**
+         * Tries to move the provided item in this LinkedSet
+         * at the specified index (at the beginning if no index is provided).
+         * @param item to add.
+         * @param index where to add the item. Must be within bounds. 0 by default.
+         * @return true if adding was succesfull, false otherwise.
+         */
+        bool add(T&& item, uint16_t index = 0) override
+        {
+            uint16_t _{};
+            return !contains(item, _) && _list.add(Memory::move(item), index);
         }
 
         /**
@@ -114,7 +130,21 @@ namespace Collection
             uint16_t _{};
             if (!contains(item, _))
             {
-                _list->append(item);
+                _list.append(item);
+            }
+        }
+
+        /**
+         * Moves the provided item in at the end of this
+         * LinkedSet.
+         * @param item to add.
+         */
+        void append(T&& item) override
+        {
+            uint16_t _{};
+            if (!contains(item, _))
+            {
+                _list.append(Memory::move(item));
             }
         }
 
@@ -124,7 +154,7 @@ namespace Collection
          */
         void remove(const T& item) override
         {
-            _list->remove(item);
+            _list.remove(item);
         }
 
         /**
@@ -134,7 +164,7 @@ namespace Collection
          */
         void remove_at(uint16_t index) override
         {
-            _list->remove_at(index);
+            _list.remove_at(index);
         }
 
         /**
@@ -142,7 +172,7 @@ namespace Collection
          */
         void clear(void) override
         {
-            _list->clear();
+            _list.clear();
         }
 
         /**
@@ -154,7 +184,7 @@ namespace Collection
          */
         T& at(uint16_t index) const override
         {
-            return _list->at(index);
+            return _list.at(index);
         }
 
         /**
@@ -166,7 +196,7 @@ namespace Collection
          */
         bool contains(const T& item, uint16_t& out_index) const override
         {
-            return _list->contains(item, out_index);
+            return _list.contains(item, out_index);
         }
 
         /**
@@ -174,23 +204,22 @@ namespace Collection
          */
         uint16_t size(void) const override
         {
-            return _list->size();
+            return _list.size();
         }
 
         /**
+         * Iterators are short lived: allocated within the active
+         * Memory::ArenaScope, if any, upon the heap otherwise.
          * @return a new instance of BaseIterator for this LinkedSet.
          */
-        Memory::U_ptr<BaseIterator<T>> create_iterator(void) const override
+        Memory::U_ptr<BaseIterator<T>, Memory::ArenaDelete<BaseIterator<T>>> create_iterator(void) const override
         {
-            return Memory::make_unique<BaseIterator<T>, LinkedSetIterator<T>>((LinkedSet*) this);
+            return Memory::make_scoped<BaseIterator<T>, LinkedSetIterator<T, A>>((LinkedSet*) this);
         }
 
-        friend class LinkedSetIterator<T>;
+        friend class LinkedSetIterator<T, A>;
 
     private:
-        const Memory::U_ptr<LinkedList<T>> _list
-        {
-            Memory::make_unique<LinkedList<T>>()
-        };
+        LinkedList<T, A> _list{ };
     };
 }
\ No newline at end of file
@@ -0,0 +1,355 @@
+/*
+ * ----------------------------------------------------------------------------
+ * MpmcQueue
+ * Bounded lock-free multi producer, multi consumer queue for threaded hosts.
+ * Part of the ArduinoLibraries project, to be used with any Arduino board.
+ * <https://github.com/Pierrolefou881/ArduinoLibraries>
+ * ----------------------------------------------------------------------------
+ *
+ * Copyright (C) 2025  Pierre DEBAS
+ * <dpierre394@gmail.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#pragma once
+#include <Memory.hpp>
+#include <stdint.h>
+
+namespace Collection
+{
+    /**
+     * Bounded first in, first out queue shared by any number of producer
+     * and consumer threads, after D. Vyukov's bounded MPMC queue. Every
+     * slot carries a sequence number telling whether it is free for the
+     * current lap or holds an item: a thread claims a position with a
+     * single compare-and-swap, then builds or takes its item without
+     * holding any lock, and publishes the slot by storing its sequence
+     * with release ordering. Batched variants claim several consecutive
+     * positions with one compare-and-swap. Items are stored within the
+     * MpmcQueue itself, nothing is ever allocated.
+     * Intended for threaded hosts; on single core boards, SpscQueue is
+     * the cheaper choice.
+     * @param T can be any type with a move constructor.
+     * @param N capacity, a power of two.
+     */
+    template<typename T, uint16_t N>
+    class MpmcQueue
+    {
+    public:
+        /**
+         * Initializes this MpmcQueue as an empty queue.
+         */
+        MpmcQueue(void)
+        {
+            for (uint16_t index = 0; index < N; index++)
+            {
+                _cells[index].sequence = index;
+            }
+        }
+
+        MpmcQueue(const MpmcQueue&) = delete;
+        MpmcQueue& operator =(const MpmcQueue&) = delete;
+
+        ~MpmcQueue(void)
+        {
+            for (auto position = _dequeue_position; position != _enqueue_position; position++)
+            {
+                item(_cells[position & MASK])->~T();
+            }
+        }
+
+        /**
+         * Adds a copy of the provided item at the tail. The item is
+         * dropped if the queue is full.
+         * @param item to add.
+         * @return true if the item was added, false otherwise.
+         */
+        bool push(const T& item)
+        {
+            return emplace(item);
+        }
+
+        /**
+         * Moves the provided item in at the tail. The item is dropped if
+         * the queue is full.
+         * @param item to add.
+         * @return true if the item was added, false otherwise.
+         */
+        bool push(T&& item)
+        {
+            return emplace(Memory::move(item));
+        }
+
+        /**
+         * See push().
+         */
+        bool try_push(const T& item)
+        {
+            return emplace(item);
+        }
+
+        /**
+         * See push().
+         */
+        bool try_push(T&& item)
+        {
+            return emplace(Memory::move(item));
+        }
+
+        /**
+         * Constructs an item in place at the tail.
+         * @param args must match one of T's constructors.
+         * @return true if the item was added, false if the queue is full.
+         */
+        template<class... Args>
+        bool emplace(Args&&... args)
+        {
+            auto position = load_relaxed(_enqueue_position);
+            Cell* cell{ };
+            for (;;)
+            {
+                cell = &_cells[position & MASK];
+                auto lag = difference(load_acquire(cell->sequence), position);
+                if (lag == 0)
+                {
+                    if (claim(_enqueue_position, position, 1))
+                    {
+                        break;
+                    }
+                }
+                else if (lag < 0)
+                {
+                    return false;
+                }
+                else
+                {
+                    position = load_relaxed(_enqueue_position);
+                }
+            }
+            new (item(*cell)) T{ Memory::forward<Args>(args)... };
+            __atomic_store_n(&cell->sequence, position + 1, __ATOMIC_RELEASE);
+            return true;
+        }
+
+        /**
+         * Adds copies of up to count items at the tail, in order, as long
+         * as there is room left. Consecutive positions are claimed at once.
+         * @param items first item to add.
+         * @param count number of items to add.
+         * @return the number of items added, from the first one.
+         */
+        uint16_t try_push_batch(const T* items, uint16_t count)
+        {
+            Position position{ };
+            auto claimed = claim_batch(_enqueue_position, position, count, 0);
+            for (uint16_t index = 0; index < claimed; index++)
+            {
+                auto& cell = _cells[(position + index) & MASK];
+                new (item(cell)) T{ items[index] };
+                __atomic_store_n(&cell.sequence, position + index + 1, __ATOMIC_RELEASE);
+            }
+            return claimed;
+        }
+
+        /**
+         * Removes the head item and moves it out.
+         * @param out_item receives the head item, untouched if the
+         *        queue is empty.
+         * @return true if an item was popped, false if the queue is empty.
+         */
+        bool try_pop(T& out_item)
+        {
+            auto position = load_relaxed(_dequeue_position);
+            Cell* cell{ };
+            for (;;)
+            {
+                cell = &_cells[position & MASK];
+                auto lag = difference(load_acquire(cell->sequence), position + 1);
+                if (lag == 0)
+                {
+                    if (claim(_dequeue_position, position, 1))
+                    {
+                        break;
+                    }
+                }
+                else if (lag < 0)
+                {
+                    return false;
+                }
+                else
+                {
+                    position = load_relaxed(_dequeue_position);
+                }
+            }
+            take(*cell, position, out_item);
+            return true;
+        }
+
+        /**
+         * Removes the head item and moves it out.
+         * @return the head item, a default T if the queue is empty.
+         */
+        T pop(void)
+        {
+            T ret_val{ };
+            try_pop(ret_val);
+            return ret_val;
+        }
+
+        /**
+         * Removes up to max_count items from the head, in order, as long
+         * as there are items left. Consecutive positions are claimed at once.
+         * @param out_items receives the popped items.
+         * @param max_count maximum number of items to pop.
+         * @return the number of items popped.
+         */
+        uint16_t try_pop_batch(T* out_items, uint16_t max_count)
+        {
+            Position position{ };
+            auto claimed = claim_batch(_dequeue_position, position, max_count, 1);
+            for (uint16_t index = 0; index < claimed; index++)
+            {
+                take(_cells[(position + index) & MASK], position + index, out_items[index]);
+            }
+            return claimed;
+        }
+
+        /**
+         * Snapshot of the number of items, possibly outdated as soon as
+         * it is returned while other threads are running.
+         * @return the number of items in this MpmcQueue.
+         */
+        uint16_t size(void) const
+        {
+            auto lag = difference(load_relaxed(_enqueue_position), load_relaxed(_dequeue_position));
+            return lag < 0 ? 0 : (lag > N ? N : lag);
+        }
+
+        /**
+         * @return true if this MpmcQueue held no item when called,
+         *         false otherwise.
+         */
+        bool is_empty(void) const
+        {
+            return size() == 0;
+        }
+
+        /**
+         * @return N, the maximum number of items.
+         */
+        uint16_t capacity(void) const
+        {
+            return N;
+        }
+
+    private:
+        typedef uintptr_t Position;
+
+        static_assert(N > 0 && (N & (N - 1)) == 0, "MpmcQueue capacity must be a power of two");
+        static const Position MASK{ N - 1 };
+
+        struct Cell
+        {
+            Position sequence;
+            alignas(T) uint8_t storage[sizeof(T)];
+        };
+
+#if defined(__x86_64__) || defined(__i386__) || defined(__aarch64__)
+        // Keeps producer and consumer positions on separate cache lines.
+        static const uint8_t CACHE_LINE{ 64 };
+        Cell _cells[N];
+        uint8_t _cells_padding[CACHE_LINE];
+        Position _enqueue_position{ };
+        uint8_t _enqueue_padding[CACHE_LINE - sizeof(Position)];
+        Position _dequeue_position{ };
+        uint8_t _dequeue_padding[CACHE_LINE - sizeof(Position)];
+#else
+        Cell _cells[N];
+        Position _enqueue_position{ };
+        Position _dequeue_position{ };
+#endif
+
+        static Position load_relaxed(const Position& position)
+        {
+            return __atomic_load_n(&position, __ATOMIC_RELAXED);
+        }
+
+        static Position load_acquire(const Position& position)
+        {
+            return __atomic_load_n(&position, __ATOMIC_ACQUIRE);
+        }
+
+        // Positions wrap around: compares them as signed distances.
+        static intptr_t difference(Position sequence, Position position)
+        {
+            return static_cast<intptr_t>(sequence - position);
+        }
+
+        static T* item(Cell& cell)
+        {
+            return (T*) cell.storage;
+        }
+
+        // Moves from expected to expected + count; reloads expected on failure.
+        static bool claim(Position& target, Position& expected, Position count)
+        {
+            return __atomic_compare_exchange_n(&target, &expected, expected + count, true, __ATOMIC_RELAXED, __ATOMIC_RELAXED);
+        }
+
+        // Claims up to count consecutive ready positions; offset 0 for
+        // free slots, 1 for filled ones. Returns the number claimed.
+        uint16_t claim_batch(Position& target, Position& out_position, uint16_t count, Position offset)
+        {
+            if (count == 0)
+            {
+                return 0;
+            }
+
+            auto position = load_relaxed(target);
+            for (;;)
+            {
+                auto lag = difference(load_acquire(_cells[position & MASK].sequence), position + offset);
+                if (lag < 0)
+                {
+                    return 0;
+                }
+                if (lag > 0)
+                {
+                    position = load_relaxed(target);
+                    continue;
+                }
+
+                uint16_t ready{ 1 };
+                while (ready < count && ready < N
+                        && load_acquire(_cells[(position + ready) & MASK].sequence) == position + ready + offset)
+                {
+                    ready++;
+                }
+                if (claim(target, position, ready))
+                {
+                    out_position = position;
+                    return ready;
+                }
+            }
+        }
+
+        static void take(Cell& cell, Position position, T& out_item)
+        {
+            auto data = item(cell);
+            out_item = Memory::move(*data);
+            data->~T();
+            __atomic_store_n(&cell.sequence, position + N, __ATOMIC_RELEASE);
+        }
+    };
+}
\ No newline at end of file
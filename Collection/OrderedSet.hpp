@@ -34,8 +34,13 @@ namespace Collection
      * adding duplicates.
      * @param T can be any type as long as it has a default initializer.
      *          Usually smart pointers.
+     * @param A allocation policy for this OrderedSet and its storage
+     *          (see Memory/src/Allocator.hpp), or Memory::InlineStorage<N>
+     *          to store up to N items inline. Memory::HeapAllocator by default.
+     * @param P capacity policy, deciding when the array grows and shrinks
+     *          (see src/CapacityPolicy.hpp). CapacityPolicy<> by default.
      */
-    template<typename T>
+    template<typename T, typename A = Memory::HeapAllocator, typename P = CapacityPolicy<>>
     class OrderedSet : public OrderedCollection<T>
     {
     public:
@@ -45,7 +50,7 @@ namespace Collection
          * @param order set to ascending by default.
          */
         OrderedSet(const Collection::SortingOrder& order = Collection::SortingOrder::ASCENDING)
-            : _container{ Memory::make_unique<ArrayContainer<T>, OrderedArrayContainer<T>>(order, ALLOWS_DUPLICATES) }
+            : _container{ order, ALLOWS_DUPLICATES }
         {
             // Empty body
         }
@@ -62,7 +67,33 @@ namespace Collection
          */
         bool add(const T& item, uint16_t index = 0) override
         {
-            return _container->add(item, index);
+            return _container.add(item, index);
+        }
+
+        /**
+         * Tries to move the provided item in this OrderedSet. Should fail
+         * if item already present.
+         * @param item to add.
+         * @param index can be any value, used as input parameter for inner
+         *        algorithms, but value shall be reset. No real purpose then.
+         * @return true if adding was succesfull, false otherwise.
+         */
+        bool add(T&& item, uint16_t index = 0) override
+        {
+            return _container.add(Memory::move(item), index);
+        }
+
+        /**
+         * Adds the provided items at once: the batch is sorted, then merged
+         * in a single pass after growing the array once. Items already
+         * present are skipped.
+         * @param items to add, count of them.
+         * @param count number of items.
+         * @return the number of items added.
+         */
+        uint16_t add_range(const T* items, uint16_t count) override
+        {
+            return _container.add_range(items, count);
         }
 
         /**
@@ -71,7 +102,7 @@ namespace Collection
          */
         void remove(const T& item) override
         {
-            _container->remove(item);
+            _container.remove(item);
         }
 
         /**
@@ -81,7 +112,7 @@ namespace Collection
          */
         void remove_at(uint16_t index) override
         {
-            _container->remove_at(index);
+            _container.remove_at(index);
         }
 
         /**
@@ -89,7 +120,7 @@ namespace Collection
          */
         void clear(void) override
         {
-            _container->clear();
+            _container.clear();
         }
 
         /**
@@ -101,7 +132,7 @@ namespace Collection
          */
         T& at(uint16_t index) const override
         {
-            return _container->data_at(index);
+            return _container.data_at(index);
         }
 
         /**
@@ -113,7 +144,7 @@ namespace Collection
          */
         bool contains(const T& item, uint16_t& out_index) const override
         {
-            return _container->contains(item, out_index);
+            return _container.contains(item, out_index);
         }
 
         /**
@@ -121,11 +152,49 @@ namespace Collection
          */
         uint16_t size(void) const override
         {
-            return _container->get_size();
+            return _container.get_size();
+        }
+
+        /**
+         * Grows the array at once so that it holds at least count items.
+         * @param count number of items to make room for.
+         * @return true if there is room for count items, false if the
+         *         array could not grow.
+         */
+        bool reserve(uint16_t count)
+        {
+            return _container.reserve(count);
+        }
+
+        /**
+         * @return the number of items this OrderedSet can hold before growing.
+         */
+        uint16_t capacity(void) const
+        {
+            return _container.capacity();
+        }
+
+        /**
+         * Shrinks the array down to the number of items, releasing unused
+         * memory. Following additions grow it again.
+         * @return true if capacity() now equals size(), false otherwise.
+         */
+        bool shrink_to_fit(void)
+        {
+            return _container.shrink_to_fit();
         }
 
     private:
         static const bool ALLOWS_DUPLICATES{ false };
-        Memory::U_ptr<ArrayContainer<T>> _container{ };
+        OrderedArrayContainer<T, A, P> _container;
     };
+
+    /**
+     * OrderedSet never allocating: up to N items are stored within the object
+     * itself, and adding fails once it is full.
+     * @param T must implement equality and comparison operators.
+     * @param N maximum number of items.
+     */
+    template<typename T, uint16_t N>
+    using StaticOrderedSet = OrderedSet<T, Memory::InlineStorage<N>>;
 }
\ No newline at end of file
@@ -29,67 +29,11 @@
 
 namespace Collection
 {
-    // Forward declaration
-    template<typename T>
-    class ProcessingCollection;
-
-    /**
-     * Iterates over ProcessingCollections without exposing their inner
-     * algorithms.
-     * @param T type of element contained in the queue. Must have a default
-     *        constructor.
-     */
-    template<typename T>
-    class ProcessingCollectionIterator : public BaseIterator<T>
-    {
-    public:
-        /**
-         * Initializes this ProcessingCollectionIterator with the provided
-         * ProcessingCollection.
-         */
-        ProcessingCollectionIterator(ProcessingCollection<T>* collection) 
-            : _collection{ collection }
-        {
-            // Empty body.
-        }
-
-        virtual ~ProcessingCollectionIterator(void) = default;
-
-        /**
-         * @return true if there is at least one element remaining to iterate
-         *         over, false otherwise.
-         */
-        bool has_next(void) const override
-        {
-            return _collection->_tail != nullptr;
-        }
-
-        /**
-         * @return the element currently iterated over.
-         */
-        T& get(void) const override
-        {
-            return _collection->_tail->_data;
-        }
-
-        /**
-         * Moves to the next element.
-         */
-        virtual void next(void) override
-        {
-            _collection = _collection->_tail.get();
-        }
-
-    private:
-        ProcessingCollection<T>* _collection{ };
-    };
-
     /**
-     * Abstract definition for collections that can be used in data
+     * Interface definition for collections that can be used in data
      * processing, like stacks and queues. Unlike traditional
      * collections, ProcessingCollection offer visibility only to
-     * the closest element. ProcessingCollection is implemented as a 
-     * linked collection and can produce iterators.
+     * the closest element, and can produce iterators.
      * @param T type of element contained in this ProcessingCollection.
      *        Must have a default constructor.
      */
@@ -97,110 +41,50 @@ namespace Collection
     class ProcessingCollection : public Iterable<T>
     {
     public:
-        /**
-         * Initializes this ProcessingCollection as an empty collection.
-         */
-        ProcessingCollection(void) = default;
-
         virtual ~ProcessingCollection(void) = default;
 
         /**
-         * Adds the provided item to this ProcessingCollection.
+         * Adds the provided item to this ProcessingCollection. The item is
+         * dropped if there is no room left for it.
          * @param item to add.
          */
         virtual void push(const T& item) = 0;
 
         /**
-         * Accesses and removes the head element.
-         * @return the head element.
+         * Moves the provided item in this ProcessingCollection. The item is
+         * dropped if there is no room left for it.
+         * @param item to add.
          */
-        T pop(void)
-        {
-            if (is_empty())
-            {
-                return { };
-            }
-            auto ret_val = _tail->_data;
-            auto new_tail = _tail->_tail;
-            _tail = new_tail;
-            return ret_val;
-        }
+        virtual void push(T&& item) = 0;
+
+        /**
+         * Removes the head element and moves it out.
+         * @return the head element, a default T if this
+         *         ProcessingCollection is empty.
+         */
+        virtual T pop(void) = 0;
 
         /**
          * Accesses the head element without removing it.
+         * CAUTION: this ProcessingCollection must not be empty.
          * @return the reference to the head element.
          */
-        T& peek(void) const
-        {
-            return _tail->_data;
-        }
+        virtual T& peek(void) const = 0;
 
         /**
-         * Removes all elements from this Queue.
+         * Removes all elements from this ProcessingCollection.
          */
-        void clear(void)
-        {
-            _tail = nullptr;
-        }
+        virtual void clear(void) = 0;
 
         /**
-         * @return true if this Queue has no element,
+         * @return true if this ProcessingCollection has no element,
          *         false otherwise.
          */
-        bool is_empty(void) const
-        {
-            return _tail == nullptr;
-        }
+        virtual bool is_empty(void) const = 0;
 
         /**
          * @return the number of elements in this ProcessingCollection.
          */
-        uint16_t size(void) const
-        {
-            return _tail == nullptr ? 0 : 1 + _tail->size(); 
-        }
-
-        /**
-         * @return a new instance of ProcessingCollectionIterator for this 
-         *         ProcessingCollection.
-         */
-        Memory::U_ptr<BaseIterator<T>> create_iterator(void) const override
-        {
-            return Memory::make_unique<BaseIterator<T>, ProcessingCollectionIterator<T>>((ProcessingCollection<T>*) this);
-        }
-
-        friend class ProcessingCollectionIterator<T>;
-    
-    protected:
-        /**
-         * Initializes a new link with the provided item.
-         * @param item can be nullptr.
-         */
-        ProcessingCollection(const T& item) 
-            : _data{ item }
-        {
-            // Empty body.
-        }
-
-        /**
-         * @return a reference to _tail for inner working.
-         */
-        const Memory::S_ptr<ProcessingCollection<T>>& get_tail(void) const
-        {
-            return _tail;
-        }
-
-        /**
-         * Assigns the provided valuie as the new _tail.
-         * @param new_tail can be nullptr.
-         */
-        void set_tail(const Memory::S_ptr<ProcessingCollection<T>>& new_tail)
-        {
-            _tail = new_tail;
-        }
-
-    private:
-        Memory::S_ptr<ProcessingCollection<T>> _tail{ };
-        T _data{ };
+        virtual uint16_t size(void) const = 0;
     };
 }
\ No newline at end of file
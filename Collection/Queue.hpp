@@ -23,7 +23,7 @@
  * along with this program.  If not, see <https://www.gnu.org/licenses/>.
  */
 #pragma once
-#include "ProcessingCollection.hpp"
+#include "src/LinkedProcessingCollection.hpp"
 #include "Iterable.hpp"
 
 namespace Collection
@@ -32,9 +32,11 @@ namespace Collection
      * First in, first out collection for processing purposes and avoiding
      * concurrent accesses.
      * @param T can be any data type. Must have a default constructor.
+     * @param A allocation policy for links (see Memory/src/Allocator.hpp).
+     *          Memory::HeapAllocator by default.
      */
-    template<typename T>
-    class Queue : public ProcessingCollection<T>
+    template<typename T, typename A = Memory::HeapAllocator>
+    class Queue : public LinkedProcessingCollection<T, A>
     {
     public:
         /**
@@ -50,20 +52,26 @@ namespace Collection
          */
         void push(const T& item) override
         {
-            if (ProcessingCollection<T>::is_empty())
-            {
-              auto new_tail = Memory::S_ptr<ProcessingCollection<T>>{ new Queue{ item } };
-              ProcessingCollection<T>::set_tail(new_tail);
-            }
-            else
-            {
-              ProcessingCollection<T>::get_tail()->push(item);
-            }
+            emplace(item);
         }
-    private:
-        Queue(const T& data) : ProcessingCollection<T>{ data }
+
+        /**
+         * Moves the provided item in at the tail of this Queue.
+         * @param item to add.
+         */
+        void push(T&& item) override
+        {
+            emplace(Memory::move(item));
+        }
+
+        /**
+         * Constructs an item in place at the tail of this Queue.
+         * @param args must match one of T's constructors.
+         */
+        template<class... Args>
+        void emplace(Args&&... args)
         {
-            // Empty body.
+            LinkedProcessingCollection<T, A>::emplace_back(Memory::forward<Args>(args)...);
         }
     };
 }
\ No newline at end of file
@@ -0,0 +1,343 @@
+/*
+ * ----------------------------------------------------------------------------
+ * RingQueue
+ * First in, first out collection stored within a circular array.
+ * Part of the ArduinoLibraries project, to be used with any Arduino board.
+ * <https://github.com/Pierrolefou881/ArduinoLibraries>
+ * ----------------------------------------------------------------------------
+ *
+ * Copyright (C) 2025  Pierre DEBAS
+ * <dpierre394@gmail.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#pragma once
+#include "ProcessingCollection.hpp"
+#include <Memory.hpp>
+#include <stdint.h>
+
+namespace Collection
+{
+    // Forward declaration
+    template<typename T, typename A>
+    class RingQueue;
+
+    /**
+     * Iterates over RingQueues from head to tail.
+     * @param T type of element contained in the RingQueue.
+     * @param A allocation policy of the RingQueue.
+     */
+    template<typename T, typename A = Memory::HeapAllocator>
+    class RingQueueIterator : public BaseIterator<T>
+    {
+    public:
+        /**
+         * Initializes this RingQueueIterator on the head of the provided
+         * RingQueue.
+         */
+        RingQueueIterator(RingQueue<T, A>* queue) : _queue{ queue }
+        {
+            // Empty body.
+        }
+
+        virtual ~RingQueueIterator(void) = default;
+
+        /**
+         * @return true if there is at least one element remaining to iterate
+         *         over, false otherwise.
+         */
+        bool has_next(void) const override
+        {
+            return _position < _queue->_size;
+        }
+
+        /**
+         * @return the element currently iterated over.
+         */
+        T& get(void) const override
+        {
+            return _queue->_data[_queue->slot(_position)];
+        }
+
+        /**
+         * Moves to the next element.
+         */
+        void next(void) override
+        {
+            _position++;
+        }
+
+    private:
+        RingQueue<T, A>* _queue{ };
+        uint16_t _position{ };
+    };
+
+    /**
+     * First in, first out ProcessingCollection storing its elements
+     * within a single circular array: push, pop, peek and size run in
+     * constant time without any recursion, and no allocation occurs
+     * as long as there is room left. When full, a growable RingQueue
+     * doubles its capacity, while a fixed one drops the pushed item.
+     * Clearing keeps the array, so that it can be reused right away.
+     * @param T can be any data type. Must have a default constructor.
+     * @param A allocation policy for the array (see Memory/src/Allocator.hpp).
+     *          Memory::HeapAllocator by default.
+     */
+    template<typename T, typename A = Memory::HeapAllocator>
+    class RingQueue : public ProcessingCollection<T>
+    {
+    public:
+        /**
+         * Initializes this RingQueue as an empty collection. Nothing is
+         * allocated until the first item is pushed.
+         * @param capacity number of elements the array initially holds.
+         *        MIN_CAPACITY by default, or if 0.
+         * @param can_grow indicates whether the array shall double its
+         *        capacity when full. True by default.
+         */
+        RingQueue(uint16_t capacity = MIN_CAPACITY, bool can_grow = true)
+            : _initial_capacity{ capacity }
+            , _can_grow{ can_grow }
+        {
+            // Empty body.
+        }
+
+        RingQueue(const RingQueue&) = delete;
+        RingQueue& operator =(const RingQueue&) = delete;
+
+        virtual ~RingQueue(void)
+        {
+            clear();
+            release();
+        }
+
+        /**
+         * Adds the provided item at the tail of this RingQueue.
+         * @param item to add.
+         */
+        void push(const T& item) override
+        {
+            emplace(item);
+        }
+
+        /**
+         * Moves the provided item in at the tail of this RingQueue.
+         * @param item to add.
+         */
+        void push(T&& item) override
+        {
+            emplace(Memory::move(item));
+        }
+
+        /**
+         * Constructs an item in place at the tail of this RingQueue.
+         * The item is dropped if the RingQueue is full and can't grow.
+         * @param args must match one of T's constructors.
+         * @return true if the item was added, false otherwise.
+         */
+        template<class... Args>
+        bool emplace(Args&&... args)
+        {
+            if (_size == _capacity && !grow())
+            {
+                return false;
+            }
+            new (_data + slot(_size)) T{ Memory::forward<Args>(args)... };
+            _size++;
+            return true;
+        }
+
+        /**
+         * Removes the head element and moves it out.
+         * @return the head element, a default T if this RingQueue is empty.
+         */
+        T pop(void) override
+        {
+            if (is_empty())
+            {
+                return { };
+            }
+            auto ret_val = Memory::move(_data[_head]);
+            _data[_head].~T();
+            _head = slot(1);
+            _size--;
+            return ret_val;
+        }
+
+        /**
+         * Accesses the head element without removing it.
+         * CAUTION: this RingQueue must not be empty.
+         * @return the reference to the head element.
+         */
+        T& peek(void) const override
+        {
+            return _data[_head];
+        }
+
+        /**
+         * Removes all elements from this RingQueue. The array is kept.
+         */
+        void clear(void) override
+        {
+            while (_size > 0)
+            {
+                _data[_head].~T();
+                _head = slot(1);
+                _size--;
+            }
+            _head = 0;
+        }
+
+        /**
+         * @return true if this RingQueue has no element, false otherwise.
+         */
+        bool is_empty(void) const override
+        {
+            return _size == 0;
+        }
+
+        /**
+         * @return the number of elements in this RingQueue.
+         */
+        uint16_t size(void) const override
+        {
+            return _size;
+        }
+
+        /**
+         * @return the number of elements this RingQueue can hold before
+         *         growing.
+         */
+        uint16_t capacity(void) const
+        {
+            return _capacity;
+        }
+
+        /**
+         * Grows the array at once so that it holds at least count elements.
+         * Works on fixed RingQueues as well, which then hold count elements
+         * before dropping pushed items.
+         * @param count number of elements to make room for.
+         * @return true if there is room for count elements, false if the
+         *         array could not grow.
+         */
+        bool reserve(uint16_t count)
+        {
+            return count <= _capacity || reallocate(count);
+        }
+
+        /**
+         * Shrinks the array down to the number of elements, releasing
+         * unused memory. An empty RingQueue releases its array, and
+         * allocates the initial capacity again upon the next push.
+         * @return true if capacity() now equals size(), false otherwise.
+         */
+        bool shrink_to_fit(void)
+        {
+            if (_size == 0)
+            {
+                release();
+                return true;
+            }
+            return _size == _capacity || reallocate(_size);
+        }
+
+        /**
+         * Iterators are short lived: allocated within the active
+         * Memory::ArenaScope, if any, upon the heap otherwise.
+         * @return a new instance of RingQueueIterator for this RingQueue.
+         */
+        Memory::U_ptr<BaseIterator<T>, Memory::ArenaDelete<BaseIterator<T>>> create_iterator(void) const override
+        {
+            return Memory::make_scoped<BaseIterator<T>, RingQueueIterator<T, A>>((RingQueue<T, A>*) this);
+        }
+
+        friend class RingQueueIterator<T, A>;
+
+    private:
+        static const uint16_t MIN_CAPACITY{ 4 };
+        static const uint16_t RESIZING_FACTOR{ 2 };
+        static const uint16_t MAX_CAPACITY{ 0xFFFF };
+
+        const uint16_t _initial_capacity{ };
+        const bool _can_grow{ };
+        T* _data{ };
+        uint16_t _head{ };
+        uint16_t _size{ };
+        uint16_t _capacity{ };
+
+        // Index within _data of the element offset positions after the head.
+        uint16_t slot(uint16_t offset) const
+        {
+            return offset < _capacity - _head ? _head + offset : offset - (_capacity - _head);
+        }
+
+        // Allocates the first array, or a larger one, unrolling the elements.
+        bool grow(void)
+        {
+            if (_data != nullptr && (!_can_grow || _capacity == MAX_CAPACITY))
+            {
+                return false;
+            }
+
+            uint16_t new_capacity{ _initial_capacity };
+            if (_data != nullptr)
+            {
+                new_capacity = _capacity > MAX_CAPACITY / RESIZING_FACTOR ? MAX_CAPACITY : _capacity * RESIZING_FACTOR;
+            }
+            else if (new_capacity == 0)
+            {
+                new_capacity = MIN_CAPACITY;
+            }
+            return reallocate(new_capacity);
+        }
+
+        // Moves the elements to a new array of new_capacity, not inferior
+        // to _size, unrolling them.
+        bool reallocate(uint16_t new_capacity)
+        {
+            auto data = static_cast<T*>(A::allocate(sizeof(T) * new_capacity, alignof(T)));
+            if (data == nullptr)
+            {
+                return false;
+            }
+            Memory::track(data, sizeof(T) * new_capacity);
+            // Unwraps the ring: items from _head to the end of the array first.
+            auto first_run = _size;
+            if (first_run > _capacity - _head)
+            {
+                first_run = _capacity - _head;
+            }
+            Memory::relocate(data, _data + _head, first_run);
+            Memory::relocate(data + first_run, _data, _size - first_run);
+            release();
+            _data = data;
+            _capacity = new_capacity;
+            return true;
+        }
+
+        // Releases the array, whose elements must be destroyed or moved out.
+        void release(void)
+        {
+            if (_data != nullptr)
+            {
+                Memory::untrack(_data);
+                A::deallocate(_data);
+            }
+            _data = nullptr;
+            _head = 0;
+            _capacity = 0;
+        }
+    };
+}
\ No newline at end of file
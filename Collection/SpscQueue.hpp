@@ -0,0 +1,230 @@
+/*
+ * ----------------------------------------------------------------------------
+ * SpscQueue
+ * Wait-free single producer, single consumer queue, e.g. from an ISR to loop().
+ * Part of the ArduinoLibraries project, to be used with any Arduino board.
+ * <https://github.com/Pierrolefou881/ArduinoLibraries>
+ * ----------------------------------------------------------------------------
+ *
+ * Copyright (C) 2025  Pierre DEBAS
+ * <dpierre394@gmail.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#pragma once
+#include <Memory.hpp>
+#include <stdint.h>
+
+namespace Collection
+{
+    /**
+     * Bounded first in, first out queue shared by exactly one producer
+     * and one consumer running concurrently, e.g. an interrupt service
+     * routine pushing and loop() popping, or two threads. Neither side
+     * ever blocks, allocates nor masks interrupts: push and pop complete
+     * in a bounded number of steps whatever the other side does.
+     * Each side writes a single index: the producer publishes an item by
+     * storing the tail with release ordering, once the item is built,
+     * and the consumer frees a slot by storing the head the same way.
+     * Items are stored within the SpscQueue itself.
+     * CAUTION: push() and emplace() must only be called by the producer,
+     *          pop() and front() only by the consumer.
+     * @param T can be any type with a move constructor.
+     * @param N capacity, strictly positive. At most 127 on AVR, where
+     *          indices are single bytes so that they are read and
+     *          written in one instruction.
+     */
+    template<typename T, uint16_t N>
+    class SpscQueue
+    {
+    public:
+        /**
+         * Initializes this SpscQueue as an empty queue.
+         */
+        SpscQueue(void) = default;
+
+        SpscQueue(const SpscQueue&) = delete;
+        SpscQueue& operator =(const SpscQueue&) = delete;
+
+        ~SpscQueue(void)
+        {
+            while (_head != _tail)
+            {
+                slot(_head)->~T();
+                _head = next(_head);
+            }
+        }
+
+        /**
+         * Producer only. Adds a copy of the provided item at the tail.
+         * @param item to add.
+         * @return true if the item was added, false if the queue is full.
+         */
+        bool push(const T& item)
+        {
+            return emplace(item);
+        }
+
+        /**
+         * Producer only. Moves the provided item in at the tail.
+         * @param item to add.
+         * @return true if the item was added, false if the queue is full.
+         */
+        bool push(T&& item)
+        {
+            return emplace(Memory::move(item));
+        }
+
+        /**
+         * Producer only. Constructs an item in place at the tail.
+         * @param args must match one of T's constructors.
+         * @return true if the item was added, false if the queue is full.
+         */
+        template<class... Args>
+        bool emplace(Args&&... args)
+        {
+            auto tail = _tail;
+            if (distance(load_acquire(_head), tail) == N)
+            {
+                return false;
+            }
+            new (slot(tail)) T{ Memory::forward<Args>(args)... };
+            store_release(_tail, next(tail));
+            return true;
+        }
+
+        /**
+         * Consumer only. Moves the head item out and removes it.
+         * @param out_item receives the head item, untouched if the
+         *        queue is empty.
+         * @return true if an item was popped, false if the queue is empty.
+         */
+        bool pop(T& out_item)
+        {
+            auto head = _head;
+            if (head == load_acquire(_tail))
+            {
+                return false;
+            }
+            auto item = slot(head);
+            out_item = Memory::move(*item);
+            item->~T();
+            store_release(_head, next(head));
+            return true;
+        }
+
+        /**
+         * Consumer only. Accesses the head item without removing it.
+         * @return the address of the head item, nullptr if the queue
+         *         is empty.
+         */
+        T* front(void) const
+        {
+            auto head = _head;
+            return head == load_acquire(_tail) ? nullptr : slot(head);
+        }
+
+        /**
+         * Snapshot of the number of items, exact only when called by
+         * either side while the other one is idle.
+         * @return the number of items in this SpscQueue.
+         */
+        uint16_t size(void) const
+        {
+            return distance(load_acquire(_head), load_acquire(_tail));
+        }
+
+        /**
+         * @return true if this SpscQueue holds no item, false otherwise.
+         */
+        bool is_empty(void) const
+        {
+            return load_acquire(_head) == load_acquire(_tail);
+        }
+
+        /**
+         * @return N, the maximum number of items.
+         */
+        uint16_t capacity(void) const
+        {
+            return N;
+        }
+
+    private:
+#if defined(__AVR__)
+        // Single byte accesses can't be torn by an interrupt.
+        typedef uint8_t Index;
+#else
+        typedef uint16_t Index;
+#endif
+        // Indices run over [0, 2N) so that full and empty differ without
+        // wasting a slot: the queue is full when tail - head equals N.
+        static_assert(N > 0 && N <= (Index(~Index{ }) >> 1), "SpscQueue capacity out of range");
+
+#if defined(__x86_64__) || defined(__i386__) || defined(__aarch64__)
+        // Keeps producer and consumer indices on separate cache lines.
+        static const uint8_t CACHE_LINE{ 64 };
+        Index _head{ };
+        uint8_t _head_padding[CACHE_LINE - sizeof(Index)];
+        Index _tail{ };
+        uint8_t _tail_padding[CACHE_LINE - sizeof(Index)];
+#else
+        Index _head{ };
+        Index _tail{ };
+#endif
+        alignas(T) uint8_t _slots[sizeof(T) * N];
+
+        static Index next(Index index)
+        {
+            return index == 2 * N - 1 ? 0 : index + 1;
+        }
+
+        static uint16_t distance(Index head, Index tail)
+        {
+            return tail >= head ? tail - head : 2 * N - head + tail;
+        }
+
+        T* slot(Index index) const
+        {
+            return (T*) _slots + (index < N ? index : index - N);
+        }
+
+#if defined(__AVR__)
+        // AVR cores are in order: a volatile access and a compiler
+        // barrier keep slot accesses on the right side of the index.
+        static Index load_acquire(const Index& index)
+        {
+            Index value = *(const volatile Index*) &index;
+            __asm__ __volatile__("" ::: "memory");
+            return value;
+        }
+
+        static void store_release(Index& index, Index value)
+        {
+            __asm__ __volatile__("" ::: "memory");
+            *(volatile Index*) &index = value;
+        }
+#else
+        static Index load_acquire(const Index& index)
+        {
+            return __atomic_load_n(&index, __ATOMIC_ACQUIRE);
+        }
+
+        static void store_release(Index& index, Index value)
+        {
+            __atomic_store_n(&index, value, __ATOMIC_RELEASE);
+        }
+#endif
+    };
+}
\ No newline at end of file
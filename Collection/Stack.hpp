@@ -23,7 +23,7 @@
  * along with this program.  If not, see <https://www.gnu.org/licenses/>.
  */
 #pragma once
-#include "ProcessingCollection.hpp"
+#include "src/LinkedProcessingCollection.hpp"
 
 namespace Collection
 {
@@ -31,9 +31,11 @@ namespace Collection
      * Last in, first out collection for processing purposes and avoiding
      * concurrent accesses.
      * @param T can be any data type. Must have a default constructor.
+     * @param A allocation policy for links (see Memory/src/Allocator.hpp).
+     *          Memory::HeapAllocator by default.
      */
-    template<typename T>
-    class Stack : public ProcessingCollection<T>
+    template<typename T, typename A = Memory::HeapAllocator>
+    class Stack : public LinkedProcessingCollection<T, A>
     {
     public:
         /**
@@ -48,21 +50,26 @@ namespace Collection
          */
         void push(const T& item) override
         {
-            auto tmp = ProcessingCollection<T>::get_tail();
-            auto new_tail = Memory::S_ptr<ProcessingCollection<T>>{ new Stack{ item } };
-            static_cast<Stack<T>*>(new_tail.get())->attach(tmp);
-            ProcessingCollection<T>::set_tail(new_tail);
+            emplace(item);
         }
 
-    private:
-        Stack(const T& data) : ProcessingCollection<T>{ data }
+        /**
+         * Moves the provided item in this Stack.
+         * @param item to add.
+         */
+        void push(T&& item) override
         {
-            // Empty body.
+            emplace(Memory::move(item));
         }
 
-        void attach(const Memory::S_ptr<ProcessingCollection<T>>& link)
+        /**
+         * Constructs an item in place on top of this Stack.
+         * @param args must match one of T's constructors.
+         */
+        template<class... Args>
+        void emplace(Args&&... args)
         {
-            ProcessingCollection<T>::set_tail(link);
+            LinkedProcessingCollection<T, A>::emplace_front(Memory::forward<Args>(args)...);
         }
     };
 }
\ No newline at end of file
@@ -44,5 +44,30 @@ namespace Collection
          * @param item to add.
          */
         virtual void append(const T& item) = 0;
+
+        /**
+         * Moves the provided item in at the end of this
+         * UnorderedCollection.
+         * @param item to add.
+         */
+        virtual void append(T&& item) = 0;
+
+        /**
+         * Appends the provided items in order at the end of this
+         * UnorderedCollection.
+         * @param items to append, count of them.
+         * @param count number of items.
+         * @return the number of items appended, fewer than count if some
+         *         were refused, e.g. duplicates within a set.
+         */
+        virtual uint16_t append_range(const T* items, uint16_t count)
+        {
+            auto previous_size = this->size();
+            for (uint16_t index = 0; index < count; index++)
+            {
+                append(items[index]);
+            }
+            return this->size() - previous_size;
+        }
     };
 }
\ No newline at end of file
@@ -24,6 +24,8 @@
  */
 #pragma once
 #include <stdint.h>
+#include <Memory.hpp>
+#include "CapacityPolicy.hpp"
 
 namespace Collection
 {
@@ -34,27 +36,37 @@ namespace Collection
      * and deletion of items. It is however an abstract class.
      * Concrete classes should implement do_add() and contains(); those
      * methods define ordered or unordered sorting.
+     * Storage is a Memory::U_array, a Memory::StaticArray if A is a
+     * Memory::InlineStorage or a Memory::SmallArray if A is a
+     * Memory::SmallStorage: only stored items are constructed and removed
+     * items are destroyed right away. A StaticArray never grows, so adding
+     * fails once it is full.
      * @param T can be any type.
+     * @param A allocation policy for the array (see Memory/src/Allocator.hpp),
+     *          Memory::InlineStorage<N> to store up to N items within this
+     *          ArrayContainer, or Memory::SmallStorage<N, B> to store the
+     *          first N items within and the others with the allocation
+     *          policy B. Memory::HeapAllocator by default.
+     * @param P capacity policy, deciding when the array grows and shrinks
+     *          (see CapacityPolicy.hpp). CapacityPolicy<> by default.
      */
-    template<typename T>
+    template<typename T, typename A = Memory::HeapAllocator, typename P = CapacityPolicy<>>
     class ArrayContainer
     {
     public:
         /**
          * Initializes this ArrayContainer with an empty array and
-         * duplication rule.
+         * duplication rule. Nothing is allocated until the first item
+         * is added.
          * @param allows_duplicates indicates whether this ArrayContainer
          *        shall allow data duplication. True by default.
          */
         ArrayContainer(bool allows_duplicates = true) : _allow_duplicates{ allows_duplicates }
         {
-            // Empty body
+            // Empty body.
         }
 
-        virtual ~ArrayContainer(void)
-        {
-            delete _data;
-        }
+        virtual ~ArrayContainer(void) = default;
 
         /**
          * Adds the provided item at the specified index. In some cases,
@@ -66,6 +78,16 @@ namespace Collection
          */
         virtual bool add(const T& item, uint16_t index = 0) = 0;
 
+        /**
+         * Moves the provided item in at the specified index. In some cases,
+         * index might not be used, so its value might not have an impact
+         * upon success of insertion.
+         * @param item to insert.
+         * @param index of insertion.
+         * @return true if insertion succesfull, false otherwise.
+         */
+        virtual bool add(T&& item, uint16_t index = 0) = 0;
+
         /**
          * Removes the first encountered occurrence of the provided
          * item, if any. Does nothing otherwise. Uses permutation
@@ -90,17 +112,12 @@ namespace Collection
         void remove_at(uint16_t index)
         {
             // Out of bounds; do nothing.
-            if (index >= _current_size)
+            if (index >= _data.size())
             {
                 return;
             }
-            _current_size--;
-            for (auto i = index; i < _current_size; i++)
-            {
-                _data[i] = _data[i + 1];
-            }
-
-            manage_capacity(_current_size);
+            _data.erase(index);
+            manage_capacity(_data.size());
         }
 
         /**
@@ -110,30 +127,24 @@ namespace Collection
          */
         void remove_all(const T& item)
         {
-            for (uint16_t current_index = _current_size - 1; current_index > 0; current_index--)
+            for (auto current_index = _data.size(); current_index > 0; current_index--)
             {
-                if (_data[current_index] == item)
+                if (_data[current_index - 1] == item)
                 {
-                    _current_size--;
-                    for (auto swap_index = current_index; 
-                        swap_index < _current_size; 
-                        swap_index++)
-                    {
-                        _data[swap_index] = _data[swap_index + 1];
-                    }
+                    _data.erase(current_index - 1);
                 }
             }
-            manage_capacity(_current_size);
+            manage_capacity(_data.size());
         }
 
         /**
          * Removes all items from this ArrayContainer.
-         * Does it by setting the size at 0.
+         * Items are destroyed and the array shrinks back.
          */
         void clear(void)
         {
-            _current_size = 0;
-            manage_capacity(_current_size);
+            _data.clear();
+            manage_capacity(0);
         }
 
         /**
@@ -156,34 +167,73 @@ namespace Collection
         /**
          * @return this ArrayContainer's current size.
          */
-        uint16_t get_size(void) const { return _current_size; }
+        uint16_t get_size(void) const { return _data.size(); }
+
+        /**
+         * @return the number of items this ArrayContainer can hold
+         *         before growing.
+         */
+        uint16_t capacity(void) const { return _data.capacity(); }
+
+        /**
+         * Grows the array at once so that it holds at least count items,
+         * following the growth steps of P. Never shrinks it.
+         * @param count number of items to make room for.
+         * @return true if there is room for count items, false if the
+         *         array could not grow.
+         */
+        bool reserve(uint32_t count)
+        {
+            auto capacity = _data.capacity();
+            if (count <= capacity)
+            {
+                return true;
+            }
+            if (count > MAX_CAPACITY)
+            {
+                return false;
+            }
+            auto new_capacity = P::grow(capacity, count);
+            if (new_capacity > MAX_CAPACITY)
+            {
+                new_capacity = MAX_CAPACITY;
+            }
+            return _data.reallocate(new_capacity);
+        }
+
+        /**
+         * Shrinks the array down to its size, releasing unused memory.
+         * @return true if capacity() now equals the size, false if the
+         *         smaller array could not be obtained.
+         */
+        bool shrink_to_fit(void)
+        {
+            return _data.reallocate(_data.size());
+        }
         
     protected:
 
         /**
          * Proceeds to the actual adding of an item at the given
-         * index.
-         * @param item to add.
+         * index. Following items are moved one step forward, then
+         * the item is constructed in place with the provided arguments.
          * @param index of insertion. Must be within bounds.
+         * @param args must match one of T's constructors, e.g. the item
+         *        to copy or move.
+         * @return true if insertion successful, false if the array
+         *         could not grow.
          */
-        void do_add(const T& item, uint16_t index)
+        template<class... Args>
+        bool do_add(uint16_t index, Args&&... args)
         {
-            manage_capacity(_current_size + 1);
-            _current_size++;
-            T current_item = _data[index];
-            _data[index] = item;
-            for (auto i = index + 1; i < _current_size; i++)
-            {
-                auto tmp = _data[i];
-                _data[i] = current_item;
-                current_item = tmp;
-            }
+            return reserve(_data.size() + uint32_t{ 1 }) 
+                    && _data.emplace(index, Memory::forward<Args>(args)...);
         }
 
         /**
          * @return the number of elements contained in the array.
          */
-        uint16_t current_size(void) const { return _current_size; }
+        uint16_t current_size(void) const { return _data.size(); }
 
         /**
          * @return true if this ArrayContainer allows data duplication,
@@ -192,36 +242,20 @@ namespace Collection
         bool allows_duplicates(void) const { return _allow_duplicates; }
 
     private:
-        static const uint16_t MIN_CAPACITY{ 3 };
-        static const uint16_t RESIZING_FACTOR{ 2 };
+        static const uint16_t MAX_CAPACITY{ 0xFFFF };
 
         const bool _allow_duplicates{ };
-        T* _data{ new T[MIN_CAPACITY] };
-        uint16_t _current_size{ };
-        uint16_t _current_capacity{ MIN_CAPACITY };
+        typename Memory::ArrayStorage<T, A>::type _data{ };
 
+        // Shrinks the array once P deems it empty enough. Growing is up to reserve().
         void manage_capacity(uint16_t future_size)
         {
-            if (future_size == _current_capacity)
-            {
-                resize(_current_capacity * RESIZING_FACTOR);
-            }
-            else if(_current_capacity > MIN_CAPACITY && _current_capacity > RESIZING_FACTOR * future_size)
-            {
-                resize(_current_capacity / RESIZING_FACTOR);
-            }
-        }
-
-        void resize(uint16_t new_size)
-        {
-            auto tmp = _data;
-            _data = new T[new_size];
-            for (uint16_t index = 0; index < _current_size; index++)
+            auto capacity = _data.capacity();
+            auto new_capacity = P::shrink(capacity, future_size);
+            if (new_capacity < capacity)
             {
-                _data[index] = tmp[index];
+                _data.reallocate(new_capacity);
             }
-            delete tmp;
-            _current_capacity = new_size;
         }
     };
 }
\ No newline at end of file
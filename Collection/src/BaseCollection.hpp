@@ -24,6 +24,7 @@
  */
 #pragma once
 #include <stdint.h>
+#include <Memory.hpp>
 
 namespace Collection
 {
@@ -76,6 +77,34 @@ namespace Collection
          */
         virtual bool add(const T& item, uint16_t index = 0) = 0;
 
+        /**
+         * Tries to move the provided item in this BaseCollection
+         * at the specified index (at the beginning if no index is provided).
+         * @param item to add.
+         * @param index where to add the item. Must be within bounds. 0 by default.
+         * @return true if adding was succesfull, false otherwise.
+         */
+        virtual bool add(T&& item, uint16_t index = 0) = 0;
+
+        /**
+         * Adds the provided items one after the other, as add() would at
+         * the end of this BaseCollection. Array based collections grow once
+         * for the whole batch, ordered ones sort and merge it at once.
+         * @param items to add, count of them.
+         * @param count number of items.
+         * @return the number of items added, fewer than count if some were
+         *         refused, e.g. duplicates within a set.
+         */
+        virtual uint16_t add_range(const T* items, uint16_t count)
+        {
+            auto previous_size = size();
+            for (uint16_t index = 0; index < count; index++)
+            {
+                add(items[index], size());
+            }
+            return size() - previous_size;
+        }
+
         /**
          * Removes the first encountered instance of the provided item.
          * @param item to remove.
@@ -124,6 +153,12 @@ namespace Collection
             return *this; 
         }
 
+        BaseCollection<T>& operator +=(T&& item) 
+        { 
+            add(Memory::move(item));
+            return *this; 
+        }
+
         BaseCollection<T>& operator -=(const T& item)
         {
             remove(item);
@@ -0,0 +1,94 @@
+/*
+ * ----------------------------------------------------------------------------
+ * CapacityPolicy
+ * Growth and shrinking rules for array based collections.
+ * Part of the ArduinoLibraries project, to be used with any Arduino board.
+ * <https://github.com/Pierrolefou881/ArduinoLibraries>
+ * ----------------------------------------------------------------------------
+ *
+ * Copyright (C) 2025  Pierre DEBAS
+ * <dpierre394@gmail.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#pragma once
+#include <stdint.h>
+
+namespace Collection
+{
+    /**
+     * Capacity policy of array based collections: how far arrays grow once
+     * full, and when they shrink back. Arrays shrink by the growth factor,
+     * and only once they are less than 1/SHRINK full, which must be well
+     * below 1/GROWTH: an array that just grew or shrank needs many more
+     * additions or removals before it reallocates again, so that adding and
+     * removing around a boundary never reallocates on every call.
+     * @param MIN smallest capacity allocated, and below which arrays never
+     *        shrink. 3 by default.
+     * @param GROWTH factor the capacity is multiplied by when growing, and
+     *        divided by when shrinking. At least 2, 2 by default.
+     * @param SHRINK arrays shrink once their size times SHRINK is below their
+     *        capacity. Must exceed GROWTH. 0 never shrinks. 4 by default.
+     */
+    template<uint16_t MIN = 3, uint8_t GROWTH = 2, uint8_t SHRINK = 4>
+    struct CapacityPolicy
+    {
+        static_assert(MIN > 0, "Minimum capacity must not be 0");
+        static_assert(GROWTH >= 2, "Growth factor must be at least 2");
+        static_assert(SHRINK == 0 || SHRINK > GROWTH, "Shrink ratio must exceed growth factor");
+
+        /**
+         * @param capacity current capacity, inferior to count.
+         * @param count number of items to make room for.
+         * @return the capacity to grow to, at least count.
+         */
+        static uint32_t grow(uint32_t capacity, uint32_t count)
+        {
+            uint32_t new_capacity{ MIN };
+            if (capacity > new_capacity)
+            {
+                new_capacity = capacity;
+            }
+            while (new_capacity < count)
+            {
+                new_capacity *= GROWTH;
+            }
+            return new_capacity;
+        }
+
+        /**
+         * @param capacity current capacity.
+         * @param size number of items left after a removal.
+         * @return the capacity to shrink to, capacity to keep it.
+         */
+        static uint16_t shrink(uint16_t capacity, uint16_t size)
+        {
+            if (SHRINK == 0 || capacity <= MIN || capacity <= uint32_t{ SHRINK } * size)
+            {
+                return capacity;
+            }
+            uint16_t new_capacity = capacity / GROWTH;
+            return new_capacity < MIN ? MIN : new_capacity;
+        }
+    };
+
+    /**
+     * Capacity policy of arrays that only ever grow, e.g. scratch buffers
+     * refilled over and over. Memory goes back only with shrink_to_fit().
+     * @param MIN smallest capacity allocated. 3 by default.
+     * @param GROWTH factor the capacity is multiplied by when growing.
+     */
+    template<uint16_t MIN = 3, uint8_t GROWTH = 2>
+    using NeverShrink = CapacityPolicy<MIN, GROWTH, 0>;
+}
\ No newline at end of file
@@ -0,0 +1,382 @@
+/*
+ * ----------------------------------------------------------------------------
+ * HashTable
+ * Robin Hood open addressing table backing HashMap and HashSet.
+ * Part of the ArduinoLibraries project, to be used with any Arduino board.
+ * <https://github.com/Pierrolefou881/ArduinoLibraries>
+ * ----------------------------------------------------------------------------
+ *
+ * Copyright (C) 2025  Pierre DEBAS
+ * <dpierre394@gmail.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#pragma once
+#include <stdint.h>
+#include <Memory.hpp>
+
+namespace Collection
+{
+    /**
+     * Default hash functor: maps a key to 32 bits. Defined for integral,
+     * enumerated and pointer types; other key types need a specialization
+     * or a custom functor with the same call operator. HashTable scrambles
+     * the result, so that an identity such as this one spreads well.
+     * @param T type of key.
+     */
+    template<typename T>
+    struct Hash
+    {
+        uint32_t operator ()(const T& key) const
+        {
+            // Wide keys fold their upper half in; narrow ones cost nothing.
+            return sizeof(T) <= sizeof(uint32_t)
+                    ? static_cast<uint32_t>(key)
+                    : fold(static_cast<unsigned long long>(key));
+        }
+
+    private:
+        static uint32_t fold(unsigned long long value)
+        {
+            return static_cast<uint32_t>(value ^ (value >> 16 >> 16));
+        }
+    };
+
+    template<typename T>
+    struct Hash<T*>
+    {
+        uint32_t operator ()(T* key) const
+        {
+            return Hash<uintptr_t>{ }(reinterpret_cast<uintptr_t>(key));
+        }
+    };
+
+    /**
+     * Open addressing hash table with Robin Hood probing: an entry being
+     * inserted takes the slot of any entry closer to its home slot, so
+     * that probe distances stay short and even, and lookups stop as soon
+     * as they meet an entry closer to home than the sought key would be.
+     * Removal shifts the following entries back, so that no tombstone is
+     * ever left. Entries and their probe distances share a single buffer
+     * of a power of two slots, given by A, which doubles beyond 3/4 load,
+     * up to 65536 slots, i.e. 49152 entries.
+     * @param E type of entry.
+     * @param K type of key.
+     * @param KeyOf functor returning the key of an entry.
+     * @param H hash functor, returning 32 bits for a key.
+     * @param A allocation policy for the buffer.
+     */
+    template<typename E, typename K, typename KeyOf, typename H, typename A>
+    class HashTable
+    {
+    public:
+        HashTable(void) = default;
+        HashTable(const HashTable&) = delete;
+        HashTable& operator =(const HashTable&) = delete;
+
+        ~HashTable(void)
+        {
+            clear();
+            release_buffer();
+        }
+
+        /**
+         * @return the number of entries.
+         */
+        uint16_t size(void) const { return _size; }
+
+        /**
+         * @return the number of slots, 0 until the first insertion.
+         */
+        uint32_t slot_count(void) const { return _entries == nullptr ? 0 : uint32_t{ _mask } + 1; }
+
+        /**
+         * @param slot must be inferior to slot_count().
+         * @return the entry stored in the given slot, nullptr if empty.
+         */
+        E* at_slot(uint32_t slot) const
+        {
+            return _distances[slot] == EMPTY ? nullptr : _entries + slot;
+        }
+
+        /**
+         * Looks for the entry with the given key.
+         * @param key to look for.
+         * @return the entry, nullptr if not found.
+         */
+        E* find(const K& key) const
+        {
+            auto slot = find_slot(key);
+            return slot < 0 ? nullptr : _entries + slot;
+        }
+
+        /**
+         * Inserts the provided entry, whose key must not be present yet.
+         * @param entry to move in.
+         * @return true if inserted, false if the buffer could not grow.
+         */
+        bool insert(E&& entry)
+        {
+            if (!reserve(_size + 1))
+            {
+                return false;
+            }
+            place(Memory::move(entry));
+            _size++;
+            return true;
+        }
+
+        /**
+         * Removes the entry with the given key, if any.
+         * @param key of the entry to remove.
+         * @return true if an entry was removed, false otherwise.
+         */
+        bool erase(const K& key)
+        {
+            auto slot = find_slot(key);
+            if (slot < 0)
+            {
+                return false;
+            }
+            erase_slot(slot);
+            return true;
+        }
+
+        /**
+         * Removes every entry satisfying the provided predicate.
+         * @param predicate called with each entry, returns true to remove it.
+         */
+        template<typename P>
+        void erase_if(P predicate)
+        {
+            auto count = slot_count();
+            for (uint32_t slot = 0; slot < count; slot++)
+            {
+                // Erasing shifts the next entry here: check the slot again.
+                while (_distances[slot] != EMPTY && predicate(_entries[slot]))
+                {
+                    erase_slot(slot);
+                }
+            }
+        }
+
+        /**
+         * Grows the buffer at once so that count entries fit within 3/4
+         * of the slots. Never shrinks it.
+         * @param count number of entries to make room for.
+         * @return true if there is room for count entries, false if the
+         *         buffer could not grow.
+         */
+        bool reserve(uint32_t count)
+        {
+            if (count == 0)
+            {
+                return true;
+            }
+            auto bits = fitting_bits(count);
+            if (bits > MAX_BITS)
+            {
+                return false;
+            }
+            return (_entries != nullptr && bits <= _bits) || rehash(bits);
+        }
+
+        /**
+         * @return the number of entries that fit before the buffer grows,
+         *         0 until the first insertion.
+         */
+        uint16_t capacity(void) const
+        {
+            return static_cast<uint16_t>(slot_count() / 4 * 3);
+        }
+
+        /**
+         * Shrinks the buffer down to the fewest slots holding the entries
+         * within 3/4 of them, releasing it altogether when empty.
+         * @return true if the buffer now fits the entries, false if the
+         *         smaller buffer could not be allocated.
+         */
+        bool shrink_to_fit(void)
+        {
+            if (_size == 0)
+            {
+                release_buffer();
+                return true;
+            }
+            auto bits = fitting_bits(_size);
+            return bits == _bits || rehash(bits);
+        }
+
+        /**
+         * Destroys all entries. The buffer is kept.
+         */
+        void clear(void)
+        {
+            auto count = slot_count();
+            for (uint32_t slot = 0; slot < count && _size > 0; slot++)
+            {
+                if (_distances[slot] != EMPTY)
+                {
+                    _entries[slot].~E();
+                    _distances[slot] = EMPTY;
+                    _size--;
+                }
+            }
+        }
+
+    private:
+        typedef uint16_t Distance;      // Probe distance + 1, EMPTY if free.
+        static const Distance EMPTY{ 0 };
+        static const uint8_t MIN_BITS{ 3 };
+        static const uint8_t MAX_BITS{ 16 };
+
+        E* _entries{ };
+        Distance* _distances{ };
+        uint16_t _mask{ };
+        uint8_t _bits{ };
+        uint16_t _size{ };
+
+        // Fewest bits, at least MIN_BITS, so that count entries fill at most
+        // 3/4 of the slots. Above MAX_BITS if count never fits.
+        static uint8_t fitting_bits(uint32_t count)
+        {
+            uint8_t bits{ MIN_BITS };
+            while (bits <= MAX_BITS && count * 4 > (uint32_t{ 3 } << bits))
+            {
+                bits++;
+            }
+            return bits;
+        }
+
+        // Fibonacci hashing: spreads any 32 bits hash over the slots.
+        uint16_t home(const K& key) const
+        {
+            uint32_t scrambled = H{ }(key) * 2654435769UL;
+            return static_cast<uint16_t>(scrambled >> (32 - _bits));
+        }
+
+        int32_t find_slot(const K& key) const
+        {
+            if (_size == 0)
+            {
+                return -1;
+            }
+            auto slot = home(key);
+            for (Distance distance = 1; distance <= _distances[slot]; distance++)
+            {
+                if (KeyOf{ }(_entries[slot]) == key)
+                {
+                    return slot;
+                }
+                slot = (slot + 1) & _mask;
+            }
+            return -1;
+        }
+
+        // Robin Hood insertion of an entry known to be absent, room left.
+        void place(E&& entry)
+        {
+            auto slot = home(KeyOf{ }(entry));
+            Distance distance{ 1 };
+            E carried{ Memory::move(entry) };
+            for (;;)
+            {
+                if (_distances[slot] == EMPTY)
+                {
+                    new (_entries + slot) E{ Memory::move(carried) };
+                    _distances[slot] = distance;
+                    return;
+                }
+                if (_distances[slot] < distance)
+                {
+                    E displaced{ Memory::move(_entries[slot]) };
+                    _entries[slot] = Memory::move(carried);
+                    carried = Memory::move(displaced);
+                    auto tmp = _distances[slot];
+                    _distances[slot] = distance;
+                    distance = tmp;
+                }
+                slot = (slot + 1) & _mask;
+                distance++;
+            }
+        }
+
+        // Backward shift deletion: following displaced entries move one
+        // slot closer to home, until a free or home placed entry.
+        void erase_slot(uint32_t slot)
+        {
+            auto next = (slot + 1) & _mask;
+            while (_distances[next] > 1)
+            {
+                _entries[slot] = Memory::move(_entries[next]);
+                _distances[slot] = _distances[next] - 1;
+                slot = next;
+                next = (next + 1) & _mask;
+            }
+            _entries[slot].~E();
+            _distances[slot] = EMPTY;
+            _size--;
+        }
+
+        bool rehash(uint8_t bits)
+        {
+            uint32_t count = uint32_t{ 1 } << bits;
+            auto bytes = count * (sizeof(E) + sizeof(Distance));
+            auto buffer = static_cast<uint8_t*>(A::allocate(bytes, alignof(E)));
+            if (buffer == nullptr)
+            {
+                return false;
+            }
+            // Reported under the entry type rather than as raw bytes.
+            Memory::track(reinterpret_cast<E*>(buffer), bytes);
+
+            auto old_entries = _entries;
+            auto old_distances = _distances;
+            auto old_count = slot_count();
+            _entries = reinterpret_cast<E*>(buffer);
+            _distances = reinterpret_cast<Distance*>(buffer + count * sizeof(E));
+            _mask = static_cast<uint16_t>(count - 1);
+            _bits = bits;
+            for (uint32_t slot = 0; slot < count; slot++)
+            {
+                _distances[slot] = EMPTY;
+            }
+            for (uint32_t slot = 0; slot < old_count; slot++)
+            {
+                if (old_distances[slot] != EMPTY)
+                {
+                    place(Memory::move(old_entries[slot]));
+                    old_entries[slot].~E();
+                }
+            }
+            if (old_entries != nullptr)
+            {
+                Memory::untrack(old_entries);
+                A::deallocate(old_entries);
+            }
+            return true;
+        }
+
+        void release_buffer(void)
+        {
+            if (_entries != nullptr)
+            {
+                Memory::untrack(_entries);
+                A::deallocate(_entries);
+            }
+            _entries = nullptr;
+            _distances = nullptr;
+        }
+    };
+}
\ No newline at end of file
@@ -0,0 +1,53 @@
+/*
+ * ----------------------------------------------------------------------------
+ * LinkedNode
+ * Plain link of linked collections: an item and the next link.
+ * Part of the ArduinoLibraries project, to be used with any Arduino board.
+ * <https://github.com/Pierrolefou881/ArduinoLibraries>
+ * ----------------------------------------------------------------------------
+ *
+ * Copyright (C) 2025  Pierre DEBAS
+ * <dpierre394@gmail.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#pragma once
+#include <Memory.hpp>
+
+namespace Collection
+{
+    /**
+     * Link of a linked collection, holding nothing but its item and the
+     * address of the following link: no virtual table, no reference count,
+     * no shared bookkeeping. Links are owned by their collection, which
+     * creates and destroys them with its allocation policy.
+     * @param T type of the item.
+     */
+    template<typename T>
+    struct LinkedNode
+    {
+        /**
+         * Initializes this LinkedNode, constructing its item in place.
+         * @param args must match one of T's constructors.
+         */
+        template<class... Args>
+        LinkedNode(Args&&... args) : data{ Memory::forward<Args>(args)... }
+        {
+            // Empty body.
+        }
+
+        T data;
+        LinkedNode* next{ };
+    };
+}
\ No newline at end of file
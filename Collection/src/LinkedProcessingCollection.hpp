@@ -0,0 +1,261 @@
+/*
+ * ----------------------------------------------------------------------------
+ * LinkedProcessingCollection
+ * Linked implementation shared by stacks and queues.
+ * Part of the ArduinoLibraries project, to be used with any Arduino board.
+ * <https://github.com/Pierrolefou881/ArduinoLibraries>
+ * ----------------------------------------------------------------------------
+ *
+ * Copyright (C) 2025  Pierre DEBAS
+ * <dpierre394@gmail.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#pragma once
+#include <Memory.hpp>
+#include "../ProcessingCollection.hpp"
+#include "ReleaseChain.hpp"
+
+namespace Collection
+{
+    /**
+     * Link of a LinkedProcessingCollection, holding its item, the following
+     * link and its own reference count, shared through Memory::I_ptr.
+     * @param T type of the item.
+     * @param A allocation policy the link is given back to.
+     */
+    template<typename T, typename A>
+    struct ProcessingLink : public Memory::RefCounted
+    {
+        /**
+         * Initializes this ProcessingLink, constructing its item in place.
+         * @param args must match one of T's constructors.
+         */
+        template<class... Args>
+        ProcessingLink(Args&&... args) : data{ Memory::forward<Args>(args)... }
+        {
+            // Empty body.
+        }
+
+        T data;
+        Memory::I_ptr<ProcessingLink, Memory::AllocatorDelete<A, ProcessingLink>> next{ };
+    };
+
+    /**
+     * Iterates over LinkedProcessingCollections without exposing their
+     * inner algorithms.
+     * @param T type of element contained in the queue. Must have a default
+     *        constructor.
+     * @param A allocation policy of the LinkedProcessingCollection.
+     */
+    template<typename T, typename A = Memory::HeapAllocator>
+    class ProcessingCollectionIterator : public BaseIterator<T>
+    {
+    public:
+        /**
+         * Initializes this ProcessingCollectionIterator at the provided link.
+         * @param link head link of the iterated over collection, can be nullptr.
+         */
+        ProcessingCollectionIterator(ProcessingLink<T, A>* link) : _link{ link }
+        {
+            // Empty body.
+        }
+
+        virtual ~ProcessingCollectionIterator(void) = default;
+
+        /**
+         * @return true if there is at least one element remaining to iterate
+         *         over, false otherwise.
+         */
+        bool has_next(void) const override
+        {
+            return _link != nullptr;
+        }
+
+        /**
+         * @return the element currently iterated over.
+         */
+        T& get(void) const override
+        {
+            return _link->data;
+        }
+
+        /**
+         * Moves to the next element.
+         */
+        virtual void next(void) override
+        {
+            _link = _link->next.get();
+        }
+
+    private:
+        ProcessingLink<T, A>* _link{ };
+    };
+
+    /**
+     * Abstract ProcessingCollection implemented as a linked collection,
+     * base of Stack and Queue. Keeps the head and last links and the size,
+     * so that pushing at either end and counting take constant time. Each
+     * link holds its own reference count, shared through Memory::I_ptr.
+     * Items are dropped when A runs out of memory. Links are released
+     * iteratively, so that clearing or destroying a long chain does not
+     * exhaust the stack.
+     * @param T type of element contained in this LinkedProcessingCollection.
+     *        Must have a default constructor.
+     * @param A allocation policy for links (see Memory/src/Allocator.hpp).
+     *          Memory::HeapAllocator by default.
+     */
+    template<typename T, typename A = Memory::HeapAllocator>
+    class LinkedProcessingCollection : public ProcessingCollection<T>
+    {
+    public:
+        /**
+         * Initializes this LinkedProcessingCollection as an empty collection.
+         */
+        LinkedProcessingCollection(void) = default;
+
+        virtual ~LinkedProcessingCollection(void)
+        {
+            release_chain(_head, &ProcessingLink<T, A>::next);
+        }
+
+        /**
+         * Removes the head element and moves it out.
+         * @return the head element.
+         */
+        T pop(void) override
+        {
+            if (is_empty())
+            {
+                return { };
+            }
+            auto ret_val = Memory::move(_head->data);
+            auto new_head = Memory::move(_head->next);
+            _head = Memory::move(new_head);
+            _size--;
+            if (_head == nullptr)
+            {
+                _last = nullptr;
+            }
+            return ret_val;
+        }
+
+        /**
+         * Accesses the head element without removing it.
+         * @return the reference to the head element.
+         */
+        T& peek(void) const override
+        {
+            return _head->data;
+        }
+
+        /**
+         * Removes all elements from this LinkedProcessingCollection.
+         */
+        void clear(void) override
+        {
+            release_chain(_head, &ProcessingLink<T, A>::next);
+            _last = nullptr;
+            _size = 0;
+        }
+
+        /**
+         * @return true if this LinkedProcessingCollection has no element,
+         *         false otherwise.
+         */
+        bool is_empty(void) const override
+        {
+            return _head == nullptr;
+        }
+
+        /**
+         * @return the number of elements in this LinkedProcessingCollection.
+         */
+        uint16_t size(void) const override
+        {
+            return _size;
+        }
+
+        /**
+         * Iterators are short lived: allocated within the active
+         * Memory::ArenaScope, if any, upon the heap otherwise.
+         * @return a new instance of ProcessingCollectionIterator for this 
+         *         LinkedProcessingCollection.
+         */
+        Memory::U_ptr<BaseIterator<T>, Memory::ArenaDelete<BaseIterator<T>>> create_iterator(void) const override
+        {
+            return Memory::make_scoped<BaseIterator<T>, ProcessingCollectionIterator<T, A>>(_head.get());
+        }
+
+    protected:
+        /**
+         * Constructs an item in place within a new head link.
+         * @param args must match one of T's constructors.
+         */
+        template<class... Args>
+        void emplace_front(Args&&... args)
+        {
+            auto link = create_link(Memory::forward<Args>(args)...);
+            if (link == nullptr)
+            {
+                return;
+            }
+            link->next = _head;
+            if (_head == nullptr)
+            {
+                _last = link.get();
+            }
+            _head = link;
+            _size++;
+        }
+
+        /**
+         * Constructs an item in place within a new last link.
+         * @param args must match one of T's constructors.
+         */
+        template<class... Args>
+        void emplace_back(Args&&... args)
+        {
+            auto link = create_link(Memory::forward<Args>(args)...);
+            if (link == nullptr)
+            {
+                return;
+            }
+            if (_last == nullptr)
+            {
+                _head = link;
+            }
+            else
+            {
+                _last->next = link;
+            }
+            _last = link.get();
+            _size++;
+        }
+
+    private:
+        typedef Memory::I_ptr<ProcessingLink<T, A>, Memory::AllocatorDelete<A, ProcessingLink<T, A>>> Link;
+
+        Link _head{ };
+        ProcessingLink<T, A>* _last{ };
+        uint16_t _size{ };
+
+        // Link holding a new item, nullptr if A ran out of memory.
+        template<class... Args>
+        static Link create_link(Args&&... args)
+        {
+            return Link{ Memory::create<ProcessingLink<T, A>, A>(Memory::forward<Args>(args)...) };
+        }
+    };
+}
\ No newline at end of file
@@ -24,6 +24,7 @@
  */
 #pragma once
 #include "ArrayContainer.hpp"
+#include "SortedBatch.hpp"
 #include "../OrderedCollection.hpp"
 
 namespace Collection
@@ -33,9 +34,11 @@ namespace Collection
      * comparison.
      * @param T must implement some sort of comparison with operators
      *          >, <, >=, <=, == and !=.
+     * @param A allocation policy. Memory::HeapAllocator by default.
+     * @param P capacity policy. CapacityPolicy<> by default.
      */
-    template<typename T>
-    class OrderedArrayContainer : public ArrayContainer<T>
+    template<typename T, typename A = Memory::HeapAllocator, typename P = CapacityPolicy<>>
+    class OrderedArrayContainer : public ArrayContainer<T, A, P>
     {
     public:
         /**
@@ -46,7 +49,7 @@ namespace Collection
          *        shall allow data duplication. True by default.
          */
         OrderedArrayContainer(const SortingOrder& order, bool allows_duplicates = true) 
-            : ArrayContainer<T>{ allows_duplicates }, _order{ order }
+            : ArrayContainer<T, A, P>{ allows_duplicates }, _order{ order }
         {
             // Empty body
         }
@@ -62,14 +65,19 @@ namespace Collection
          */
         bool add(const T& item, uint16_t index = 0) override
         {
-            // Get the right index and check duplication rule
-            if (contains(item, index) && !ArrayContainer<T>::allows_duplicates())
-            {
-                return false;
-            }
-            
-            ArrayContainer<T>::do_add(item, index);
-            return true;
+            return insert(item, index);
+        }
+
+        /**
+         * Moves the provided item in at the correct index, so the one
+         * provided shall not be used.
+         * @param item to insert.
+         * @param index of insertion. used as inout parameter for contains.
+         * @return true if insertion succesfull, false otherwise.
+         */
+        bool add(T&& item, uint16_t index = 0) override
+        {
+            return insert(Memory::move(item), index);
         }
 
         /**
@@ -82,7 +90,7 @@ namespace Collection
         bool contains(const T& item, uint16_t& out_index) const override
         {
             out_index = 0;
-            auto max = ArrayContainer<T>::get_size();
+            auto max = ArrayContainer<T, A, P>::get_size();
 
             // Empty collection, no item to find.
             if (max == 0)
@@ -94,7 +102,7 @@ namespace Collection
             uint16_t min{ };
             for (auto middle = max; middle > min; middle = (min + max) / 2)
             {
-                auto current_item = ArrayContainer<T>::data_at(middle);
+                const auto& current_item = ArrayContainer<T, A, P>::data_at(middle);
                 if (item == current_item)   // Item found, no need to look for it anymore.
                 {
                     out_index = middle;
@@ -113,8 +121,8 @@ namespace Collection
                 }
             }
 
-            auto upper_boundary = ArrayContainer<T>::data_at(max);
-            auto lower_boundary = ArrayContainer<T>::data_at(min);
+            const auto& upper_boundary = ArrayContainer<T, A, P>::data_at(max);
+            const auto& lower_boundary = ArrayContainer<T, A, P>::data_at(min);
 
             if ((_order == SortingOrder::ASCENDING && item <= lower_boundary)
                     || (_order == SortingOrder::DESCENDING && item >= lower_boundary))
@@ -134,7 +142,126 @@ namespace Collection
             return item == lower_boundary || item == upper_boundary;
         } 
 
+        /**
+         * Constructs an item in place at the specified index, without
+         * checking order nor duplication rule. Meant to follow contains().
+         * CAUTION: index must keep items sorted.
+         * @param index of insertion, as given by contains().
+         * @param args must match one of T's constructors.
+         * @return true if insertion succesfull, false otherwise.
+         */
+        template<class... Args>
+        bool emplace_at(uint16_t index, Args&&... args)
+        {
+            return ArrayContainer<T, A, P>::do_add(index, Memory::forward<Args>(args)...);
+        }
+
+        /**
+         * Adds the provided items at once: the batch is sorted, the array
+         * grows once, then a single backward pass merges the batch with the
+         * stored items, copying each of them once. Items refused by the
+         * duplication rule are skipped. Arrays that are not heap backed
+         * merge by batches of SortedBatch<A>::MAX_COUNT items, whose
+         * indices are kept on the stack (see BatchStorage).
+         * @param items to add, count of them.
+         * @param count number of items.
+         * @return the number of items added.
+         */
+        uint16_t add_range(const T* items, uint16_t count)
+        {
+            uint16_t added{ };
+            while (count > 0)
+            {
+                auto batch_count = count;
+                if (batch_count > SortedBatch<A>::MAX_COUNT)
+                {
+                    batch_count = SortedBatch<A>::MAX_COUNT;
+                }
+                added += add_batch(items, batch_count);
+                items += batch_count;
+                count -= batch_count;
+            }
+            return added;
+        }
+
     private:
         SortingOrder _order;
+
+        bool precedes(const T& a, const T& b) const
+        {
+            return _order == SortingOrder::ASCENDING ? a < b : a > b;
+        }
+
+        // Sorts then merges up to SortedBatch<A>::MAX_COUNT items.
+        uint16_t add_batch(const T* items, uint16_t count)
+        {
+            auto before = [this](const T& a, const T& b) { return precedes(a, b); };
+            SortedBatch<A> batch{ };
+            if (!batch.sort(items, count, before))
+            {
+                return add_each(items, count);
+            }
+
+            auto size = ArrayContainer<T, A, P>::get_size();
+            if (!ArrayContainer<T, A, P>::allows_duplicates())
+            {
+                auto existing_at = [this](uint16_t index) -> const T& { return ArrayContainer<T, A, P>::data_at(index); };
+                batch.drop_duplicates(items, existing_at, size, before);
+            }
+            if (!ArrayContainer<T, A, P>::reserve(size + uint32_t{ batch.size() }))
+            {
+                return add_each(items, count);
+            }
+
+            // Copy the sorted batch at the end, then merge from the greatest
+            // items down. Batch items stay in place until a stored one moves.
+            for (uint16_t rank = 0; rank < batch.size(); rank++)
+            {
+                ArrayContainer<T, A, P>::do_add(size + rank, items[batch[rank]]);
+            }
+            auto stored = size;
+            auto target = ArrayContainer<T, A, P>::get_size();
+            for (auto rank = batch.size(); rank > 0; )
+            {
+                const auto& item = items[batch[rank - 1]];
+                target--;
+                if (size > 0 && precedes(item, ArrayContainer<T, A, P>::data_at(size - 1)))
+                {
+                    ArrayContainer<T, A, P>::data_at(target) = Memory::move(ArrayContainer<T, A, P>::data_at(--size));
+                }
+                else
+                {
+                    if (size < stored)
+                    {
+                        ArrayContainer<T, A, P>::data_at(target) = item;
+                    }
+                    rank--;
+                }
+            }
+            return batch.size();
+        }
+
+        // Fallback when the batch cannot be sorted at once.
+        uint16_t add_each(const T* items, uint16_t count)
+        {
+            uint16_t added{ };
+            for (uint16_t index = 0; index < count; index++)
+            {
+                added += add(items[index]);
+            }
+            return added;
+        }
+
+        template<typename U>
+        bool insert(U&& item, uint16_t index)
+        {
+            // Get the right index and check duplication rule
+            if (contains(item, index) && !ArrayContainer<T, A, P>::allows_duplicates())
+            {
+                return false;
+            }
+            
+            return ArrayContainer<T, A, P>::do_add(index, Memory::forward<U>(item));
+        }
     };
 }
\ No newline at end of file
@@ -0,0 +1,53 @@
+/*
+ * ----------------------------------------------------------------------------
+ * ReleaseChain
+ * Iterative release of chains of smart pointer linked links.
+ * Part of the ArduinoLibraries project, to be used with any Arduino board.
+ * <https://github.com/Pierrolefou881/ArduinoLibraries>
+ * ----------------------------------------------------------------------------
+ *
+ * Copyright (C) 2025  Pierre DEBAS
+ * <dpierre394@gmail.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#pragma once
+#include <Memory.hpp>
+
+namespace Collection
+{
+    /**
+     * Releases the chain of links starting at head, one link at a time,
+     * in constant stack space. Left alone, destroying the first link
+     * destroys its next link from within its destructor, and so on, so
+     * that a long chain overflows the stack. Each link the chain owns
+     * exclusively gets its next link detached before being released;
+     * the walk stops at the first link still referenced elsewhere, which
+     * then merely loses one reference. head is nullptr afterwards.
+     * @param P smart pointer to a link, e.g. Memory::S_ptr or Memory::I_ptr.
+     * @param L type of link, holding its next link as a P member.
+     * @param head first link of the chain, can be nullptr.
+     * @param next member of L holding the next link.
+     */
+    template<typename P, typename L>
+    void release_chain(P& head, P L::* next)
+    {
+        while (head != nullptr && head.count() == 1)
+        {
+            auto following = Memory::move(head.get()->*next);
+            head = Memory::move(following);
+        }
+        head = nullptr;
+    }
+}
\ No newline at end of file
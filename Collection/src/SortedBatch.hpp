@@ -0,0 +1,242 @@
+/*
+ * ----------------------------------------------------------------------------
+ * SortedBatch
+ * Sorted view of a batch of items to merge into a sorted array.
+ * Part of the ArduinoLibraries project, to be used with any Arduino board.
+ * <https://github.com/Pierrolefou881/ArduinoLibraries>
+ * ----------------------------------------------------------------------------
+ *
+ * Copyright (C) 2025  Pierre DEBAS
+ * <dpierre394@gmail.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#pragma once
+#include <stdint.h>
+#include <Memory.hpp>
+
+namespace Collection
+{
+    /**
+     * Exposes as type the storage policy of the indices sorted by a
+     * SortedBatch, and as MAX_COUNT the largest batch sorted at once.
+     * Indices come from the heap only for heap backed collections. Any
+     * other policy may not spare, or reclaim out of order, memory for a
+     * temporary taken between two of the collection's own allocations:
+     * e.g. StaticAllocator could then no longer grow the array in place.
+     * Indices are then kept within the SortedBatch, i.e. on the stack, and
+     * batches are bounded to 32 items. Small storage takes indices as its
+     * overflow policy does.
+     * @param A allocation policy of the collection.
+     */
+    template<typename A>
+    struct BatchStorage
+    {
+        static const uint16_t MAX_COUNT{ 32 };
+        typedef Memory::InlineStorage<MAX_COUNT> type;
+    };
+
+    template<>
+    struct BatchStorage<Memory::HeapAllocator>
+    {
+        typedef Memory::HeapAllocator type;
+        static const uint16_t MAX_COUNT{ 0xFFFF };
+    };
+
+    template<uint16_t N>
+    struct BatchStorage<Memory::InlineStorage<N>>
+    {
+        static const uint16_t MAX_COUNT{ N < 32 ? N : 32 };
+        typedef Memory::InlineStorage<MAX_COUNT> type;
+    };
+
+    template<uint16_t N, typename B>
+    struct BatchStorage<Memory::SmallStorage<N, B>> : public BatchStorage<B> { };
+
+    /**
+     * Sorts a batch of items by their indices, so that sorted arrays can
+     * merge the whole batch at once in linear time instead of searching and
+     * shifting for every item. Items themselves are neither copied nor moved:
+     * callers copy each of them once, straight to its final position.
+     * Sorting is a stable bottom-up merge sort without recursion, over short
+     * runs sorted by insertion; an already sorted batch costs a single pass.
+     * @param A allocation policy of the collection, see BatchStorage for
+     *          the one of the indices.
+     */
+    template<typename A>
+    class SortedBatch
+    {
+    public:
+        /**
+         * Largest number of items sorted at once. Larger batches are to
+         * be split by callers.
+         */
+        static const uint16_t MAX_COUNT{ BatchStorage<A>::MAX_COUNT };
+
+        /**
+         * Sorts the indices of the provided items. Items deemed equal keep
+         * their original order.
+         * @param items to sort, count of them.
+         * @param count number of items, up to MAX_COUNT.
+         * @param before returns true if its first argument must be placed
+         *        before its second one.
+         * @return true if sorted, false if indices could not be allocated
+         *         or count exceeds MAX_COUNT.
+         */
+        template<typename T, typename B>
+        bool sort(const T* items, uint16_t count, B before)
+        {
+            _indices.clear();
+            if (count > MAX_COUNT || (count > 0 && !_indices.reallocate(count)))
+            {
+                return false;
+            }
+            auto sorted = true;
+            for (uint16_t index = 0; index < count; index++)
+            {
+                sorted = sorted && (index == 0 || !before(items[index], items[index - 1]));
+                _indices.emplace(index, index);
+            }
+            if (sorted)
+            {
+                return true;
+            }
+
+            Storage merged{ };
+            if (!merged.reallocate(count))
+            {
+                return false;
+            }
+            for (uint16_t index = 0; index < count; index++)
+            {
+                merged.emplace(index, index);
+            }
+            for (uint32_t start = 0; start < count; start += RUN)
+            {
+                insertion_sort(items, start, start + RUN < count ? start + RUN : count, before);
+            }
+
+            // Runs double at each pass, back and forth between both arrays.
+            auto source = &_indices;
+            auto target = &merged;
+            for (uint32_t width = RUN; width < count; width *= 2)
+            {
+                for (uint32_t start = 0; start < count; start += 2 * width)
+                {
+                    merge(items, *source, *target, start, width, count, before);
+                }
+                auto tmp = source;
+                source = target;
+                target = tmp;
+            }
+            if (source != &_indices)
+            {
+                for (uint16_t index = 0; index < count; index++)
+                {
+                    _indices[index] = merged[index];
+                }
+            }
+            return true;
+        }
+
+        /**
+         * Drops items equal to a previous one in the batch or to an item of
+         * the provided sorted array, so that merging keeps a set a set.
+         * Among equal items of the batch, the first one provided is kept.
+         * @param items sorted by sort().
+         * @param existing_at returns the item at a given index of the sorted
+         *        array the batch will merge into.
+         * @param existing_count number of items in that array.
+         * @param before same ordering as given to sort().
+         */
+        template<typename T, typename E, typename B>
+        void drop_duplicates(const T* items, E existing_at, uint16_t existing_count, B before)
+        {
+            uint16_t kept{ };
+            uint16_t current{ };
+            for (uint16_t index = 0; index < _indices.size(); index++)
+            {
+                const auto& item = items[_indices[index]];
+                while (current < existing_count && before(existing_at(current), item))
+                {
+                    current++;
+                }
+                auto duplicate = (current < existing_count && !before(item, existing_at(current)))
+                        || (kept > 0 && !before(items[_indices[kept - 1]], item));
+                if (!duplicate)
+                {
+                    _indices[kept++] = _indices[index];
+                }
+            }
+            while (_indices.size() > kept)
+            {
+                _indices.erase(_indices.size() - 1);
+            }
+        }
+
+        /**
+         * @return the number of items in the batch.
+         */
+        uint16_t size(void) const { return _indices.size(); }
+
+        /**
+         * @param rank of an item in sorted order. Must be within bounds.
+         * @return the index of that item in the provided items.
+         */
+        uint16_t operator [](uint16_t rank) const { return _indices[rank]; }
+
+    private:
+        typedef typename Memory::ArrayStorage<uint16_t, typename BatchStorage<A>::type>::type Storage;
+        static const uint16_t RUN{ 16 };
+
+        Storage _indices{ };
+
+        template<typename T, typename B>
+        void insertion_sort(const T* items, uint32_t start, uint32_t end, B& before)
+        {
+            for (auto current = start + 1; current < end; current++)
+            {
+                auto index = _indices[current];
+                auto position = current;
+                for (; position > start && before(items[index], items[_indices[position - 1]]); position--)
+                {
+                    _indices[position] = _indices[position - 1];
+                }
+                _indices[position] = index;
+            }
+        }
+
+        // Merges source runs [start, start + width) and the next one into target.
+        template<typename T, typename B>
+        static void merge(const T* items, const Storage& source, Storage& target, uint32_t start, uint32_t width, uint32_t count, B& before)
+        {
+            auto middle = start + width < count ? start + width : count;
+            auto end = middle + width < count ? middle + width : count;
+            auto left = start;
+            auto right = middle;
+            for (auto position = start; position < end; position++)
+            {
+                // Taking left on ties keeps the sort stable.
+                if (right >= end || (left < middle && !before(items[source[right]], items[source[left]])))
+                {
+                    target[position] = source[left++];
+                }
+                else
+                {
+                    target[position] = source[right++];
+                }
+            }
+        }
+    };
+}
\ No newline at end of file
@@ -27,8 +27,8 @@
 
 namespace Collection
 {
-    template<typename T>
-    class UnorderedArrayContainer : public ArrayContainer<T>
+    template<typename T, typename A = Memory::HeapAllocator, typename P = CapacityPolicy<>>
+    class UnorderedArrayContainer : public ArrayContainer<T, A, P>
     {
     public:
         /**
@@ -37,7 +37,7 @@ namespace Collection
          * @param allows_duplicates indicates whether this UnorderedArrayContainer
          *        shall allow data duplication. True by default.
          */
-        UnorderedArrayContainer(bool allows_duplicates = true) : ArrayContainer<T>{ allows_duplicates }
+        UnorderedArrayContainer(bool allows_duplicates = true) : ArrayContainer<T, A, P>{ allows_duplicates }
         {
             // Empty body
         }
@@ -53,16 +53,38 @@ namespace Collection
          */
         bool add(const T& item, uint16_t index = 0) override
         {
-            uint16_t _;
-            // Out of bounds, don't go further. Allow one step out of bound for appending.
-            // Check duplication rule as well.
-            if (index > ArrayContainer<T>::current_size() || (!ArrayContainer<T>::allows_duplicates() && contains(item, _)))
+            return insert(item, index);
+        }
+
+        /**
+         * Moves the provided item in at the specified index. Insertion should
+         * fail if item strictly out of bounds, i.e. strictly superior to _current_size.
+         * @param item to insert.
+         * @param index of insertion. Max value _current_size.
+         * @return true if insertion succesfull, false otherwise.
+         */
+        bool add(T&& item, uint16_t index = 0) override
+        {
+            return insert(Memory::move(item), index);
+        }
+
+        /**
+         * Constructs an item in place at the specified index. Insertion should
+         * fail if item strictly out of bounds, i.e. strictly superior to _current_size.
+         * @param index of insertion. Max value _current_size.
+         * @param args must match one of T's constructors.
+         * @return true if insertion succesfull, false otherwise.
+         */
+        template<class... Args>
+        bool emplace(uint16_t index, Args&&... args)
+        {
+            // Duplicates can only be checked upon an existing item.
+            if (!ArrayContainer<T, A, P>::allows_duplicates())
             {
-                return false;
+                return insert(T{ Memory::forward<Args>(args)... }, index);
             }
-
-            ArrayContainer<T>::do_add(item, index);
-            return true;
+            return index <= ArrayContainer<T, A, P>::current_size() 
+                    && ArrayContainer<T, A, P>::do_add(index, Memory::forward<Args>(args)...);
         }
 
         /**
@@ -74,9 +96,9 @@ namespace Collection
         bool contains(const T& item, uint16_t& out_index) const override
         {
             out_index = 0;
-            for (uint16_t current_index = 0; current_index < ArrayContainer<T>::current_size(); current_index++)
+            for (uint16_t current_index = 0; current_index < ArrayContainer<T, A, P>::current_size(); current_index++)
             {
-                if (item == ArrayContainer<T>::data_at(current_index))
+                if (item == ArrayContainer<T, A, P>::data_at(current_index))
                 {
                     out_index = current_index;
                     return true;
@@ -84,5 +106,39 @@ namespace Collection
             }
             return false;
         }
+
+        /**
+         * Appends the provided items in order, growing the array once
+         * beforehand. Items refused by the duplication rule are skipped.
+         * @param items to append, count of them.
+         * @param count number of items.
+         * @return the number of items appended.
+         */
+        uint16_t append_range(const T* items, uint16_t count)
+        {
+            // Best effort: if the whole batch does not fit, append what fits.
+            ArrayContainer<T, A, P>::reserve(ArrayContainer<T, A, P>::current_size() + uint32_t{ count });
+            uint16_t added{ };
+            for (uint16_t index = 0; index < count; index++)
+            {
+                added += insert(items[index], ArrayContainer<T, A, P>::current_size());
+            }
+            return added;
+        }
+
+    private:
+        template<typename U>
+        bool insert(U&& item, uint16_t index)
+        {
+            uint16_t _;
+            // Out of bounds, don't go further. Allow one step out of bound for appending.
+            // Check duplication rule as well.
+            if (index > ArrayContainer<T, A, P>::current_size() || (!ArrayContainer<T, A, P>::allows_duplicates() && contains(item, _)))
+            {
+                return false;
+            }
+
+            return ArrayContainer<T, A, P>::do_add(index, Memory::forward<U>(item));
+        }
     };
 }
\ No newline at end of file
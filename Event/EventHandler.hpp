@@ -59,7 +59,7 @@ namespace Event
          */
         void register_callback(void (*function)(TS*, TA))
         {
-            auto callback = Memory::make_shared<Callable<TS, TA>, FunctionCallback<TS, TA>>(function);
+            auto callback = Memory::make_intrusive<Callable<TS, TA>, FunctionCallback<TS, TA>>(function);
             _callbacks->append(callback);
         }
 
@@ -72,7 +72,7 @@ namespace Event
         template<typename TI>
         void register_callback(TI* instance, void (TI::*method)(TS*, TA))
         {
-            auto callback = Memory::make_shared<Callable<TS, TA>, MethodCallback<TS, TA, TI>>(instance, method);
+            auto callback = Memory::make_intrusive<Callable<TS, TA>, MethodCallback<TS, TA, TI>>(instance, method);
             _callbacks->append(callback);
         }
 
@@ -106,7 +106,7 @@ namespace Event
          */
         void call(TS* sender, TA args) const override
         {
-            auto iterable = static_cast<Collection::LinkedSet<Memory::S_ptr<Callable<TS, TA>>>*>(_callbacks.get());
+            auto iterable = static_cast<Collection::LinkedSet<Memory::I_ptr<Callable<TS, TA>>>*>(_callbacks.get());
             auto iterator = iterable->create_iterator();
             while (iterator->has_next()) 
             {
@@ -135,21 +135,22 @@ namespace Event
     private:
         static const char TYPE{ 'E' };
 
-        Memory::U_ptr<Collection::UnorderedCollection<Memory::S_ptr<Callable<TS, TA>>>> _callbacks
+        Memory::U_ptr<Collection::UnorderedCollection<Memory::I_ptr<Callable<TS, TA>>>> _callbacks
         {
-            Memory::make_unique<Collection::UnorderedCollection<Memory::S_ptr<Callable<TS, TA>>>, 
-                                Collection::LinkedSet<Memory::S_ptr<Callable<TS, TA>>>>()
+            Memory::make_unique<Collection::UnorderedCollection<Memory::I_ptr<Callable<TS, TA>>>, 
+                                Collection::LinkedSet<Memory::I_ptr<Callable<TS, TA>>>>()
         };
 
         void do_remove(const Callable<TS, TA>& callback)
         {
-            auto iterator = _callbacks->create_iterator();
+            auto iterable = static_cast<Collection::LinkedSet<Memory::I_ptr<Callable<TS, TA>>>*>(_callbacks.get());
+            auto iterator = iterable->create_iterator();
             bool has_found{ };
-            Memory::S_ptr<Callable<TS, TA>> current_item{ };
+            Memory::I_ptr<Callable<TS, TA>> current_item{ };
             while (iterator->has_next() && !has_found)
             {
                 current_item = iterator->get();
-                has_found = callback.equals(current_item);
+                has_found = callback.equals(*current_item);
                 iterator->next();
             }
 
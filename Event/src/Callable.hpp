@@ -23,6 +23,7 @@
  * along with this program.  If not, see <https://www.gnu.org/licenses/>.
  */
 #pragma once
+#include <Memory.hpp>
 
 namespace Event
 {
@@ -34,9 +35,11 @@ namespace Event
      * @param TS type of sender. Owner of the triggered event.
      * @param TA type of args. Defines the context of the call. 
      *           Can be of any type.
+     * Callables hold their own reference count and are shared
+     * through Memory::I_ptr.
      */
     template<typename TS, typename TA>
-    class Callable
+    class Callable : public Memory::RefCounted
     {
     public:
         /**
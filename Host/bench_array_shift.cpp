@@ -0,0 +1,130 @@
+/*
+ * ----------------------------------------------------------------------------
+ * bench_array_shift
+ * Cost of inserting and removing at the front of array lists.
+ * Part of the ArduinoLibraries project, to be used with any Arduino board.
+ * <https://github.com/Pierrolefou881/ArduinoLibraries>
+ * ----------------------------------------------------------------------------
+ *
+ * Copyright (C) 2025  Pierre DEBAS
+ * <dpierre394@gmail.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+// Every insertion or removal at index 0 shifts the whole array, which is a
+// single memmove for trivially copyable elements (see Memory/src/Relocate.hpp).
+// Measures filling a list from the front, add(x, 0) + remove_at(0) pairs at
+// a constant size, then draining it from the front, checking the order of
+// items. Sizes are uint16_t, hence 65000 items at most.
+// The gap with element-wise moves shows at -Os, the Arduino default:
+// make bench CXXFLAGS="-std=gnu++11 -Os -Wall -Wextra"
+#include <Memory.hpp>
+#include <ArrayList.hpp>
+#include <chrono>
+#include <stdio.h>
+#include <stdint.h>
+
+namespace
+{
+    const uint16_t SIZES[]{ 1000, 4000, 16000, 65000 };
+    const uint16_t PAIRS{ 20000 };
+
+    // 12 bytes, trivially copyable.
+    struct Sample
+    {
+        int32_t value;
+        int32_t time;
+        int32_t flags;
+
+        Sample(int32_t reading = 0) : value{ reading }, time{ reading }, flags{ }
+        {
+            // Empty body.
+        }
+
+        bool operator ==(const Sample& other) const { return value == other.value; }
+    };
+
+    int32_t value_of(int32_t item) { return item; }
+    int32_t value_of(const Sample& item) { return item.value; }
+
+    struct Timings
+    {
+        double fill;
+        double pair;
+        double drain;
+        bool ordered;
+    };
+
+    double seconds_since(std::chrono::steady_clock::time_point start)
+    {
+        std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+        return elapsed.count();
+    }
+
+    template<typename T>
+    Timings run(uint16_t count)
+    {
+        Timings timings{ };
+        Collection::ArrayList<T> list{ };
+        auto start = std::chrono::steady_clock::now();
+        for (uint16_t index = 0; index < count; index++)
+        {
+            list.add(T{ index }, 0);
+        }
+        timings.fill = seconds_since(start) / count;
+
+        start = std::chrono::steady_clock::now();
+        for (uint16_t pair = 0; pair < PAIRS; pair++)
+        {
+            list.add(T{ -1 }, 0);
+            list.remove_at(0);
+        }
+        timings.pair = seconds_since(start) / PAIRS;
+
+        // Filled from the front: items come out from count - 1 down to 0.
+        timings.ordered = list.size() == count;
+        start = std::chrono::steady_clock::now();
+        for (int32_t expected = count - 1; expected >= 0; expected--)
+        {
+            timings.ordered = timings.ordered && value_of(list.at(0)) == expected;
+            list.remove_at(0);
+        }
+        timings.drain = seconds_since(start) / count;
+        return timings;
+    }
+
+    template<typename T>
+    bool report(const char* name)
+    {
+        printf("ArrayList<%s>, ns per operation\n", name);
+        printf("   items   fill front   add + remove at 0   drain front\n");
+        bool ordered{ true };
+        for (auto count : SIZES)
+        {
+            auto timings = run<T>(count);
+            ordered = ordered && timings.ordered;
+            printf("  %5u     %8.1f            %8.1f      %8.1f\n", count,
+                   timings.fill * 1e9, timings.pair * 1e9, timings.drain * 1e9);
+        }
+        return ordered;
+    }
+}
+
+int main(void)
+{
+    auto ordered = report<int32_t>("int32_t");
+    ordered = report<Sample>("Sample") && ordered;
+    printf("  items in order: %s\n", ordered ? "yes" : "NO");
+    return ordered ? 0 : 1;
+}
\ No newline at end of file
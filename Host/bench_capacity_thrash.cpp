@@ -0,0 +1,107 @@
+/*
+ * ----------------------------------------------------------------------------
+ * bench_capacity_thrash
+ * Allocations of array lists adding and removing around a capacity boundary.
+ * Part of the ArduinoLibraries project, to be used with any Arduino board.
+ * <https://github.com/Pierrolefou881/ArduinoLibraries>
+ * ----------------------------------------------------------------------------
+ *
+ * Copyright (C) 2025  Pierre DEBAS
+ * <dpierre394@gmail.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+// Each list is filled to a size where the array is exactly full, then goes
+// through cycles of one addition, two removals and one addition: the pattern
+// that reallocated twice per cycle when arrays halved at half full. Capacity
+// policies with a gap between growth and shrinking only grow once, on the
+// first addition.
+#include <Memory.hpp>
+#include <ArrayList.hpp>
+#include <chrono>
+#include <stdio.h>
+#include <stdlib.h>
+
+namespace
+{
+    const uint16_t SIZES[]{ 12, 96, 768, 6144 };
+    const long CYCLES{ 100000 };
+
+    long allocations{ };
+
+    // Heap allocation counting calls.
+    struct CountingAllocator : public Memory::AllocatorTag
+    {
+        static void* allocate(size_t size, size_t)
+        {
+            allocations++;
+            return malloc(size);
+        }
+
+        static void deallocate(void* data)
+        {
+            free(data);
+        }
+
+        static bool reallocate(void*, size_t)
+        {
+            return false;
+        }
+    };
+
+    struct Result
+    {
+        long allocations;
+        double nanoseconds;
+    };
+
+    template<typename P>
+    Result run(uint16_t size)
+    {
+        Collection::ArrayList<int32_t, CountingAllocator, P> list{ };
+        for (uint16_t index = 0; index < size; index++)
+        {
+            list.append(index);
+        }
+
+        auto before = allocations;
+        auto start = std::chrono::steady_clock::now();
+        for (long cycle = 0; cycle < CYCLES; cycle++)
+        {
+            list.append(cycle);
+            list.remove_at(list.size() - 1);
+            list.remove_at(list.size() - 1);
+            list.append(cycle);
+        }
+        std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+        return { allocations - before, elapsed.count() * 1e9 / CYCLES };
+    }
+}
+
+int main(void)
+{
+    printf("ArrayList<int32_t>, %ld cycles of append + 2 x remove_at + append\n", CYCLES);
+    printf("   size      CapacityPolicy<> allocations / ns per cycle      NeverShrink<> allocations / ns per cycle\n");
+    bool stable{ true };
+    for (auto size : SIZES)
+    {
+        auto policy = run<Collection::CapacityPolicy<>>(size);
+        auto never = run<Collection::NeverShrink<>>(size);
+        stable = stable && policy.allocations <= 1 && never.allocations <= 1;
+        printf("  %5u      %8ld %8.1f                                %8ld %8.1f\n", size,
+               policy.allocations, policy.nanoseconds, never.allocations, never.nanoseconds);
+    }
+    printf("  at most one allocation: %s\n", stable ? "yes" : "NO");
+    return stable ? 0 : 1;
+}
\ No newline at end of file
@@ -0,0 +1,109 @@
+/*
+ * ----------------------------------------------------------------------------
+ * bench_hash_map
+ * Add, lookup and removal costs of HashMap against ArrayMap.
+ * Part of the ArduinoLibraries project, to be used with any Arduino board.
+ * <https://github.com/Pierrolefou881/ArduinoLibraries>
+ * ----------------------------------------------------------------------------
+ *
+ * Copyright (C) 2025  Pierre DEBAS
+ * <dpierre394@gmail.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+// Fills each map with scattered uint16_t keys, looks keys up, then removes
+// them all. The largest size is the one HashMap supports: 3/4 of 2^16 slots.
+#include <Memory.hpp>
+#include <ArrayMap.hpp>
+#include <HashMap.hpp>
+#include <chrono>
+#include <stdio.h>
+#include <stdint.h>
+
+namespace
+{
+    const uint16_t SIZES[]{ 16, 256, 4096, 16384, 49152 };
+    const uint32_t LOOKUPS{ 200000 };
+
+    struct Timings
+    {
+        double add;
+        double get;
+        double remove;
+        uint32_t checksum;
+    };
+
+    double seconds_since(std::chrono::steady_clock::time_point start)
+    {
+        std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+        return elapsed.count();
+    }
+
+    // Odd multiplier: distinct indices give distinct, scattered keys.
+    uint16_t key_at(uint32_t index)
+    {
+        return static_cast<uint16_t>(index * 40503u);
+    }
+
+    template<typename M>
+    Timings run(uint16_t count)
+    {
+        Timings timings{ };
+        M map{ };
+        auto start = std::chrono::steady_clock::now();
+        for (uint16_t index = 0; index < count; index++)
+        {
+            map.add(key_at(index), index);
+        }
+        timings.add = seconds_since(start) / count;
+
+        start = std::chrono::steady_clock::now();
+        for (uint32_t lookup = 0; lookup < LOOKUPS; lookup++)
+        {
+            uint16_t value{ };
+            if (map.try_get(key_at(lookup % count), value))
+            {
+                timings.checksum += value;
+            }
+        }
+        timings.get = seconds_since(start) / LOOKUPS;
+
+        start = std::chrono::steady_clock::now();
+        for (uint16_t index = 0; index < count; index++)
+        {
+            map.remove(key_at(index));
+        }
+        timings.remove = seconds_since(start) / count;
+        timings.checksum += map.size();
+        return timings;
+    }
+}
+
+int main(void)
+{
+    printf("uint16_t keys and values, ns per operation\n");
+    printf("   keys      ArrayMap add / get / remove       HashMap add / get / remove\n");
+    bool same{ true };
+    for (auto count : SIZES)
+    {
+        auto array = run<Collection::ArrayMap<uint16_t, uint16_t>>(count);
+        auto hash = run<Collection::HashMap<uint16_t, uint16_t>>(count);
+        same = same && array.checksum == hash.checksum;
+        printf("  %5u   %8.1f %8.1f %8.1f      %8.1f %8.1f %8.1f\n", count, 
+               array.add * 1e9, array.get * 1e9, array.remove * 1e9, 
+               hash.add * 1e9, hash.get * 1e9, hash.remove * 1e9);
+    }
+    printf("  same results: %s\n", same ? "yes" : "NO");
+    return same ? 0 : 1;
+}
\ No newline at end of file
@@ -0,0 +1,86 @@
+/*
+ * ----------------------------------------------------------------------------
+ * bench_linked_list
+ * Append, contains, remove and teardown costs of LinkedList.
+ * Part of the ArduinoLibraries project, to be used with any Arduino board.
+ * <https://github.com/Pierrolefou881/ArduinoLibraries>
+ * ----------------------------------------------------------------------------
+ *
+ * Copyright (C) 2025  Pierre DEBAS
+ * <dpierre394@gmail.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+// Fills a LinkedList<int32_t> by appending, then looks up and removes random
+// values. Sizes go beyond what uint16_t counts: size() then wraps around,
+// but appends, lookups and removals by value walk the links and stay valid.
+#include <Memory.hpp>
+#include <LinkedList.hpp>
+#include <chrono>
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+namespace
+{
+    const uint32_t SIZES[]{ 1000, 10000, 100000, 1000000 };
+    const uint16_t QUERIES{ 100 };
+
+    double seconds_since(std::chrono::steady_clock::time_point start)
+    {
+        std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+        return elapsed.count();
+    }
+}
+
+int main(void)
+{
+    printf("LinkedList<int32_t>, %u random lookups and removals per size\n", QUERIES);
+    printf("     size   append/op   contains/op    remove/op    teardown\n");
+    bool found_all{ true };
+    for (auto count : SIZES)
+    {
+        auto list = new Collection::LinkedList<int32_t>{ };
+        auto start = std::chrono::steady_clock::now();
+        for (uint32_t item = 0; item < count; item++)
+        {
+            list->append((int32_t) item);
+        }
+        auto append = seconds_since(start) / count;
+
+        srand(1);
+        uint16_t index{ };
+        start = std::chrono::steady_clock::now();
+        for (uint16_t query = 0; query < QUERIES; query++)
+        {
+            found_all = list->contains((int32_t) (rand() % count), index) && found_all;
+        }
+        auto contains = seconds_since(start) / QUERIES;
+
+        start = std::chrono::steady_clock::now();
+        for (uint16_t query = 0; query < QUERIES; query++)
+        {
+            list->remove((int32_t) (rand() % count));
+        }
+        auto remove = seconds_since(start) / QUERIES;
+
+        start = std::chrono::steady_clock::now();
+        delete list;
+        auto teardown = seconds_since(start);
+        printf("  %7u   %6.0f ns   %8.1f us   %8.1f us   %7.2f ms\n", 
+               count, append * 1e9, contains * 1e6, remove * 1e6, teardown * 1e3);
+    }
+    printf("  every lookup found: %s\n", found_all ? "yes" : "NO");
+    return found_all ? 0 : 1;
+}
\ No newline at end of file
@@ -0,0 +1,92 @@
+/*
+ * ----------------------------------------------------------------------------
+ * bench_linked_node
+ * Memory taken by each element of a LinkedList.
+ * Part of the ArduinoLibraries project, to be used with any Arduino board.
+ * <https://github.com/Pierrolefou881/ArduinoLibraries>
+ * ----------------------------------------------------------------------------
+ *
+ * Copyright (C) 2025  Pierre DEBAS
+ * <dpierre394@gmail.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+// Appends items to lists whose allocation policy counts calls and bytes, so
+// that everything a list allocates per element is seen, whatever the node
+// layout. Overhead is what each element takes beyond sizeof(T).
+#include <Memory.hpp>
+#include <LinkedList.hpp>
+#include <src/Callable.hpp>
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+namespace
+{
+    const uint16_t COUNT{ 1000 };
+
+    size_t allocations{ };
+    size_t bytes{ };
+
+    // Heap allocation counting calls and requested bytes.
+    struct CountingAllocator : public Memory::AllocatorTag
+    {
+        static void* allocate(size_t size, size_t)
+        {
+            allocations++;
+            bytes += size;
+            return malloc(size);
+        }
+
+        static void deallocate(void* data)
+        {
+            free(data);
+        }
+
+        static bool reallocate(void*, size_t)
+        {
+            return false;
+        }
+    };
+
+    typedef Event::Callable<void*, int> Callable;
+
+    template<typename T>
+    bool report(const char* name)
+    {
+        Collection::LinkedList<T, CountingAllocator> list{ };
+        auto allocations_before = allocations;
+        auto bytes_before = bytes;
+        for (uint16_t item = 0; item < COUNT; item++)
+        {
+            list.append(T{ });
+        }
+        double per_allocation = static_cast<double>(allocations - allocations_before) / COUNT;
+        double per_element = static_cast<double>(bytes - bytes_before) / COUNT;
+        printf("  %-20s %6u %10.1f %10.1f B %10.1f B %8u B\n", name, static_cast<unsigned>(sizeof(T)),
+               per_allocation, per_element, per_element - sizeof(T), static_cast<unsigned>(sizeof(list)));
+        return list.size() == COUNT;
+    }
+}
+
+int main(void)
+{
+    printf("LinkedList, %u elements, per element\n", COUNT);
+    printf("  T                    sizeof allocations      bytes    overhead   list header\n");
+    auto complete = report<char>("char");
+    complete = report<Memory::S_ptr<Callable>>("S_ptr<Callable>") && complete;
+    complete = report<Memory::I_ptr<Callable>>("I_ptr<Callable>") && complete;
+    printf("  every element added: %s\n", complete ? "yes" : "NO");
+    return complete ? 0 : 1;
+}
\ No newline at end of file
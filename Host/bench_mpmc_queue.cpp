@@ -0,0 +1,195 @@
+/*
+ * ----------------------------------------------------------------------------
+ * bench_mpmc_queue
+ * Scaling of MpmcQueue against a Queue guarded by a mutex.
+ * Part of the ArduinoLibraries project, to be used with any Arduino board.
+ * <https://github.com/Pierrolefou881/ArduinoLibraries>
+ * ----------------------------------------------------------------------------
+ *
+ * Copyright (C) 2025  Pierre DEBAS
+ * <dpierre394@gmail.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+// K producer threads push integers that K consumer threads pop, for K from
+// 1 up to half the hardware threads (at least 4). Each queue holds 1024
+// items. The sum of popped items is checked against the pushed ones.
+#include <Memory.hpp>
+#include <MpmcQueue.hpp>
+#include <Queue.hpp>
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <stdio.h>
+#include <stdint.h>
+#include <thread>
+#include <vector>
+
+namespace
+{
+    const uint32_t ITEMS{ 2000000 };
+    const uint16_t CAPACITY{ 1024 };
+    const uint16_t BATCH{ 16 };
+
+    // Baseline: the linked Queue, bounded like the MpmcQueue, behind a mutex.
+    class LockedQueue
+    {
+    public:
+        bool try_push(uint32_t item)
+        {
+            std::lock_guard<std::mutex> lock{ _mutex };
+            if (_queue.size() >= CAPACITY)
+            {
+                return false;
+            }
+            _queue.push(item);
+            return true;
+        }
+
+        bool try_pop(uint32_t& out_item)
+        {
+            std::lock_guard<std::mutex> lock{ _mutex };
+            if (_queue.is_empty())
+            {
+                return false;
+            }
+            out_item = _queue.pop();
+            return true;
+        }
+
+    private:
+        std::mutex _mutex{ };
+        Collection::Queue<uint32_t> _queue{ };
+    };
+
+    typedef Collection::MpmcQueue<uint32_t, CAPACITY> Mpmc;
+
+    // One item per call.
+    struct Single
+    {
+        template<typename Q>
+        static uint16_t push(Q& queue, const uint32_t* items, uint16_t)
+        {
+            return queue.try_push(items[0]) ? 1 : 0;
+        }
+
+        template<typename Q>
+        static uint16_t pop(Q& queue, uint32_t* out_items)
+        {
+            return queue.try_pop(out_items[0]) ? 1 : 0;
+        }
+    };
+
+    // Up to BATCH items per call.
+    struct Batched
+    {
+        static uint16_t push(Mpmc& queue, const uint32_t* items, uint16_t count)
+        {
+            return queue.try_push_batch(items, count);
+        }
+
+        static uint16_t pop(Mpmc& queue, uint32_t* out_items)
+        {
+            return queue.try_pop_batch(out_items, BATCH);
+        }
+    };
+
+    template<typename M, typename Q>
+    double run(Q& queue, unsigned pairs, bool& out_sum_ok)
+    {
+        const uint32_t per_producer{ ITEMS / pairs };
+        const uint32_t total{ per_producer * pairs };
+        std::atomic<uint32_t> popped{ 0 };
+        std::atomic<uint64_t> sum{ 0 };
+        std::vector<std::thread> threads{ };
+        auto start = std::chrono::steady_clock::now();
+        for (unsigned consumer = 0; consumer < pairs; consumer++)
+        {
+            threads.emplace_back([&] {
+                uint32_t items[BATCH];
+                uint64_t local_sum{ };
+                while (popped.load(std::memory_order_relaxed) < total)
+                {
+                    auto count = M::pop(queue, items);
+                    if (count == 0)
+                    {
+                        std::this_thread::yield();
+                        continue;
+                    }
+                    for (uint16_t index = 0; index < count; index++)
+                    {
+                        local_sum += items[index];
+                    }
+                    popped += count;
+                }
+                sum += local_sum;
+            });
+        }
+        for (unsigned producer = 0; producer < pairs; producer++)
+        {
+            threads.emplace_back([&] {
+                uint32_t items[BATCH];
+                for (uint32_t next = 0; next < per_producer; )
+                {
+                    uint16_t count{ BATCH };
+                    if (per_producer - next < count)
+                    {
+                        count = per_producer - next;
+                    }
+                    for (uint16_t index = 0; index < count; index++)
+                    {
+                        items[index] = next + index;
+                    }
+                    auto pushed = M::push(queue, items, count);
+                    if (pushed == 0)
+                    {
+                        std::this_thread::yield();
+                    }
+                    next += pushed;
+                }
+            });
+        }
+        for (auto& thread : threads)
+        {
+            thread.join();
+        }
+        std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+        out_sum_ok = out_sum_ok && sum == (uint64_t) pairs * per_producer * (per_producer - 1) / 2;
+        return total / elapsed.count() / 1e6;
+    }
+}
+
+int main(void)
+{
+    unsigned max_pairs{ std::thread::hardware_concurrency() / 2 };
+    if (max_pairs < 4)
+    {
+        max_pairs = 4;
+    }
+    printf("M items/s, %u hardware threads\n", std::thread::hardware_concurrency());
+    printf("  producers+consumers   mutex+Queue   MpmcQueue   MpmcQueue batch %u\n", BATCH);
+    bool sum_ok{ true };
+    for (unsigned pairs = 1; pairs <= max_pairs; pairs *= 2)
+    {
+        LockedQueue locked{ };
+        static Mpmc single{ };
+        static Mpmc batched{ };
+        auto locked_rate = run<Single>(locked, pairs, sum_ok);
+        auto single_rate = run<Single>(single, pairs, sum_ok);
+        auto batched_rate = run<Batched>(batched, pairs, sum_ok);
+        printf("  %2u+%-2u                 %8.2f    %8.2f    %8.2f\n", pairs, pairs, locked_rate, single_rate, batched_rate);
+    }
+    printf("  sums match: %s\n", sum_ok ? "yes" : "NO");
+    return sum_ok ? 0 : 1;
+}
\ No newline at end of file
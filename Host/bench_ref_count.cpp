@@ -0,0 +1,100 @@
+/*
+ * ----------------------------------------------------------------------------
+ * bench_ref_count
+ * Copy and destroy throughput of S_ptr and I_ptr for a counting policy.
+ * Part of the ArduinoLibraries project, to be used with any Arduino board.
+ * <https://github.com/Pierrolefou881/ArduinoLibraries>
+ * ----------------------------------------------------------------------------
+ *
+ * Copyright (C) 2025  Pierre DEBAS
+ * <dpierre394@gmail.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+// Built once per policy with -DMEMORY_REF_COUNT=<policy>, see the Makefile.
+// Every thread copies then destroys pointers to the same object, so that
+// all of them hammer a single count. NonAtomicCount can't be shared across
+// threads and only runs single threaded.
+#include <Memory.hpp>
+#include <chrono>
+#include <stdio.h>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+#define NAME(policy) #policy
+#define POLICY_NAME(policy) NAME(policy)
+
+namespace
+{
+    const long ITERATIONS{ 2000000 };
+
+    struct Shared : public Memory::RefCounted
+    {
+        int value{ 1 };
+    };
+
+    template<typename P, typename F>
+    double run(unsigned threads, const P& shared, F read)
+    {
+        auto start = std::chrono::steady_clock::now();
+        std::vector<std::thread> workers{ };
+        for (unsigned thread = 0; thread < threads; thread++)
+        {
+            workers.emplace_back([&shared, read] {
+                volatile long sink{ };
+                for (long iteration = 0; iteration < ITERATIONS; iteration++)
+                {
+                    P copy{ shared };
+                    sink = sink + read(copy);
+                }
+            });
+        }
+        for (auto& worker : workers)
+        {
+            worker.join();
+        }
+        std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+        return ITERATIONS * threads / elapsed.count() / 1e6;
+    }
+}
+
+int main(void)
+{
+    const bool thread_safe{ !std::is_same<Memory::RefCount, Memory::NonAtomicCount>::value };
+    // At least 4 threads, so that the count is contended even on small hosts.
+    unsigned max_threads{ 1 };
+    if (thread_safe)
+    {
+        max_threads = std::thread::hardware_concurrency();
+        if (max_threads < 4)
+        {
+            max_threads = 4;
+        }
+    }
+
+    auto s_shared = Memory::make_shared<int>(1);
+    auto i_shared = Memory::make_intrusive<Shared>();
+    printf("%s, %ld copies and destructions per thread\n", POLICY_NAME(MEMORY_REF_COUNT), ITERATIONS);
+    bool counts_ok{ true };
+    for (unsigned threads = 1; threads <= max_threads; threads *= 2)
+    {
+        auto s_rate = run(threads, s_shared, [](const Memory::S_ptr<int>& copy) { return *copy; });
+        auto i_rate = run(threads, i_shared, [](const Memory::I_ptr<Shared>& copy) { return copy->value; });
+        counts_ok = counts_ok && s_shared.count() == 1 && i_shared.count() == 1;
+        printf("  threads %2u   S_ptr %8.1f M/s   I_ptr %8.1f M/s\n", threads, s_rate, i_rate);
+    }
+    printf("  counts back to 1: %s\n", counts_ok ? "yes" : "NO");
+    return counts_ok ? 0 : 1;
+}
\ No newline at end of file
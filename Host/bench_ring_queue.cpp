@@ -0,0 +1,78 @@
+/*
+ * ----------------------------------------------------------------------------
+ * bench_ring_queue
+ * Cost of pushing then draining a linked Queue and an array backed RingQueue.
+ * Part of the ArduinoLibraries project, to be used with any Arduino board.
+ * <https://github.com/Pierrolefou881/ArduinoLibraries>
+ * ----------------------------------------------------------------------------
+ *
+ * Copyright (C) 2025  Pierre DEBAS
+ * <dpierre394@gmail.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+// Pushes count integers, then pops them all, checking their order.
+#include <Memory.hpp>
+#include <Queue.hpp>
+#include <RingQueue.hpp>
+#include <chrono>
+#include <stdio.h>
+#include <stdint.h>
+
+namespace
+{
+    const uint16_t SIZES[]{ 1000, 4000, 60000 };
+
+    double seconds_since(std::chrono::steady_clock::time_point start)
+    {
+        std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+        return elapsed.count();
+    }
+
+    // Returns the time taken, negative if items came out of order.
+    template<typename Q>
+    double run(uint16_t count)
+    {
+        Q queue{ };
+        auto start = std::chrono::steady_clock::now();
+        for (uint16_t item = 0; item < count; item++)
+        {
+            queue.push(item);
+        }
+        bool ordered{ queue.size() == count };
+        for (uint16_t item = 0; item < count; item++)
+        {
+            ordered = ordered && queue.pop() == item;
+        }
+        auto elapsed = seconds_since(start);
+        return ordered && queue.is_empty() ? elapsed : -1;
+    }
+}
+
+int main(void)
+{
+    printf("uint16_t items, push all then pop all, ms\n");
+    printf("   items      Queue   RingQueue\n");
+    bool ordered{ true };
+    for (auto count : SIZES)
+    {
+        auto ring = run<Collection::RingQueue<uint16_t>>(count);
+        ordered = ordered && ring >= 0;
+        auto linked = run<Collection::Queue<uint16_t>>(count);
+        ordered = ordered && linked >= 0;
+        printf("  %5u   %8.3f    %8.3f\n", count, linked * 1e3, ring * 1e3);
+    }
+    printf("  items in order: %s\n", ordered ? "yes" : "NO");
+    return ordered ? 0 : 1;
+}
\ No newline at end of file
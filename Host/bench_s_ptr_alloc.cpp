@@ -0,0 +1,125 @@
+/*
+ * ----------------------------------------------------------------------------
+ * bench_s_ptr_alloc
+ * Heap allocations made by each S_ptr.
+ * Part of the ArduinoLibraries project, to be used with any Arduino board.
+ * <https://github.com/Pierrolefou881/ArduinoLibraries>
+ * ----------------------------------------------------------------------------
+ *
+ * Copyright (C) 2025  Pierre DEBAS
+ * <dpierre394@gmail.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+// Replaces the global operator new and delete to count every heap allocation
+// and the bytes requested, whatever allocates them. All pointers of a round
+// stay alive until it is reported, so that no allocation can be elided.
+#include <Memory.hpp>
+#include <new>
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+namespace
+{
+    const uint16_t COUNT{ 1000 };
+
+    size_t allocations{ };
+    size_t bytes{ };
+
+    void* counted_allocate(size_t size)
+    {
+        allocations++;
+        bytes += size;
+        auto data = malloc(size == 0 ? 1 : size);
+        if (data == nullptr)
+        {
+            throw std::bad_alloc{ };
+        }
+        return data;
+    }
+
+    // Typical payload of a callback or a sensor reading.
+    struct Payload
+    {
+        int32_t value{ };
+        int32_t timestamp{ };
+    };
+
+    Memory::S_ptr<Payload> pointers[COUNT];
+
+    // Fills all pointers with create(), reports, then empties them.
+    template<typename F>
+    size_t report(const char* name, F create)
+    {
+        auto allocations_before = allocations;
+        auto bytes_before = bytes;
+        for (uint16_t index = 0; index < COUNT; index++)
+        {
+            pointers[index] = create();
+        }
+        auto round_allocations = allocations - allocations_before;
+        double per_allocation = static_cast<double>(round_allocations) / COUNT;
+        double per_pointer = static_cast<double>(bytes - bytes_before) / COUNT;
+        printf("  %-20s %10.1f %10.1f B\n", name, per_allocation, per_pointer);
+        for (uint16_t index = 0; index < COUNT; index++)
+        {
+            pointers[index] = Memory::S_ptr<Payload>{ };
+        }
+        return round_allocations;
+    }
+}
+
+void* operator new(size_t size)
+{
+    return counted_allocate(size);
+}
+
+void* operator new[](size_t size)
+{
+    return counted_allocate(size);
+}
+
+void operator delete(void* data) noexcept
+{
+    free(data);
+}
+
+void operator delete[](void* data) noexcept
+{
+    free(data);
+}
+
+void operator delete(void* data, size_t) noexcept
+{
+    free(data);
+}
+
+void operator delete[](void* data, size_t) noexcept
+{
+    free(data);
+}
+
+int main(void)
+{
+    printf("S_ptr<Payload>, %u pointers, per pointer, sizeof(Payload) = %u B, sizeof(S_ptr) = %u B\n",
+           COUNT, static_cast<unsigned>(sizeof(Payload)), static_cast<unsigned>(sizeof(Memory::S_ptr<Payload>)));
+    printf("  S_ptr                allocations      bytes\n");
+    auto null_allocations = report("nullptr", [] { return Memory::S_ptr<Payload>{ }; });
+    auto shared_allocations = report("make_shared", [] { return Memory::make_shared<Payload>(); });
+    auto adopted_allocations = report("S_ptr(new T)", [] { return Memory::S_ptr<Payload>{ new Payload{ } }; });
+    auto expected = null_allocations == 0 && shared_allocations == COUNT && adopted_allocations == 2 * COUNT;
+    printf("  nullptr allocates nothing, make_shared once: %s\n", expected ? "yes" : "NO");
+    return expected ? 0 : 1;
+}
\ No newline at end of file
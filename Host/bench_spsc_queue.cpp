@@ -0,0 +1,124 @@
+/*
+ * ----------------------------------------------------------------------------
+ * bench_spsc_queue
+ * Throughput and latency of SpscQueue between two threads.
+ * Part of the ArduinoLibraries project, to be used with any Arduino board.
+ * <https://github.com/Pierrolefou881/ArduinoLibraries>
+ * ----------------------------------------------------------------------------
+ *
+ * Copyright (C) 2025  Pierre DEBAS
+ * <dpierre394@gmail.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+// A producer thread pushes a sequence of integers that a consumer thread
+// pops and checks, then two queues bounce a value back and forth to time
+// a round trip.
+#include <Memory.hpp>
+#include <SpscQueue.hpp>
+#include <chrono>
+#include <stdio.h>
+#include <stdint.h>
+#include <thread>
+
+namespace
+{
+    const uint32_t ITEMS{ 20000000 };
+    const uint32_t ROUND_TRIPS{ 200000 };
+
+    Collection::SpscQueue<uint32_t, 1024> stream{ };
+    Collection::SpscQueue<uint32_t, 16> ping{ };
+    Collection::SpscQueue<uint32_t, 16> pong{ };
+
+    double seconds_since(std::chrono::steady_clock::time_point start)
+    {
+        std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+        return elapsed.count();
+    }
+
+    bool throughput(void)
+    {
+        bool in_order{ true };
+        auto start = std::chrono::steady_clock::now();
+        std::thread consumer{ [&in_order] {
+            uint32_t item{ };
+            for (uint32_t expected = 0; expected < ITEMS; )
+            {
+                if (!stream.pop(item))
+                {
+                    std::this_thread::yield();
+                    continue;
+                }
+                in_order = in_order && item == expected;
+                expected++;
+            }
+        } };
+        for (uint32_t item = 0; item < ITEMS; )
+        {
+            if (stream.push(item))
+            {
+                item++;
+            }
+            else
+            {
+                std::this_thread::yield();
+            }
+        }
+        consumer.join();
+        auto elapsed = seconds_since(start);
+        printf("  throughput  %8.1f M items/s   (%u items, in order: %s)\n", 
+               ITEMS / elapsed / 1e6, ITEMS, in_order ? "yes" : "NO");
+        return in_order;
+    }
+
+    void latency(void)
+    {
+        std::thread echo{ [] {
+            uint32_t item{ };
+            for (uint32_t round = 0; round < ROUND_TRIPS; round++)
+            {
+                while (!ping.pop(item))
+                {
+                    std::this_thread::yield();
+                }
+                while (!pong.push(item))
+                {
+                    std::this_thread::yield();
+                }
+            }
+        } };
+        auto start = std::chrono::steady_clock::now();
+        uint32_t item{ };
+        for (uint32_t round = 0; round < ROUND_TRIPS; round++)
+        {
+            ping.push(round);
+            while (!pong.pop(item))
+            {
+                std::this_thread::yield();
+            }
+        }
+        auto elapsed = seconds_since(start);
+        echo.join();
+        printf("  round trip  %8.0f ns        (one way about %.0f ns)\n", 
+               elapsed / ROUND_TRIPS * 1e9, elapsed / ROUND_TRIPS * 1e9 / 2);
+    }
+}
+
+int main(void)
+{
+    printf("SpscQueue, one producer thread and one consumer thread\n");
+    auto in_order = throughput();
+    latency();
+    return in_order ? 0 : 1;
+}
\ No newline at end of file
@@ -0,0 +1,202 @@
+/*
+ * ----------------------------------------------------------------------------
+ * test_add_range
+ * Checks that adding a range gives the same collection as adding one by one.
+ * Part of the ArduinoLibraries project, to be used with any Arduino board.
+ * <https://github.com/Pierrolefou881/ArduinoLibraries>
+ * ----------------------------------------------------------------------------
+ *
+ * Copyright (C) 2025  Pierre DEBAS
+ * <dpierre394@gmail.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+// Each scenario fills one collection with add_range() and another with
+// add(), from the same items, then compares them item by item. Collections
+// on a StaticAllocator must also give all of their storage back once
+// destroyed: add_range() must not strand memory the allocator can only
+// reclaim in order.
+#include <Memory.hpp>
+#include <ArrayMap.hpp>
+#include <OrderedSet.hpp>
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+namespace
+{
+    const uint16_t STATIC_ITEMS{ 40 };
+    const uint16_t HEAP_ITEMS{ 1000 };
+
+    struct SetTag { };
+    struct MapTag { };
+    typedef Memory::StaticAllocator<SetTag, 256> SetStorage;
+    typedef Memory::StaticAllocator<MapTag, 2048> MapStorage;
+
+    // No default constructor: add_range() must construct from the items.
+    struct Reading
+    {
+        int32_t value;
+
+        explicit Reading(int32_t reading) : value{ reading }
+        {
+            // Empty body.
+        }
+
+        bool operator ==(const Reading& other) const { return value == other.value; }
+        bool operator <(const Reading& other) const { return value < other.value; }
+        bool operator >(const Reading& other) const { return value > other.value; }
+        bool operator <=(const Reading& other) const { return value <= other.value; }
+        bool operator >=(const Reading& other) const { return value >= other.value; }
+    };
+
+    // Distinct values in scattered order.
+    int32_t scattered(uint16_t index)
+    {
+        return (index * 37) % 101;
+    }
+
+    template<typename S>
+    bool same_sets(const S& ranged, const S& sequential)
+    {
+        bool same{ ranged.size() == sequential.size() };
+        for (uint16_t index = 0; same && index < ranged.size(); index++)
+        {
+            same = ranged.at(index) == sequential.at(index);
+        }
+        return same;
+    }
+
+    bool set_static(void)
+    {
+        int32_t items[STATIC_ITEMS];
+        for (uint16_t index = 0; index < STATIC_ITEMS; index++)
+        {
+            items[index] = scattered(index);
+        }
+
+        // One set at a time: each one has the whole storage.
+        int32_t expected[STATIC_ITEMS];
+        uint16_t added{ };
+        size_t used{ };
+        {
+            Collection::OrderedSet<int32_t, SetStorage> sequential{ };
+            for (auto item : items)
+            {
+                added += sequential.add(item);
+            }
+            for (uint16_t index = 0; index < sequential.size(); index++)
+            {
+                expected[index] = sequential.at(index);
+            }
+            used = SetStorage::used();
+        }
+        auto released = SetStorage::used() == 0;
+
+        bool same{ };
+        {
+            Collection::OrderedSet<int32_t, SetStorage> ranged{ };
+            same = ranged.add_range(items, STATIC_ITEMS) == added && ranged.size() == added
+                    && SetStorage::used() <= used;
+            for (uint16_t index = 0; same && index < added; index++)
+            {
+                same = ranged.at(index) == expected[index];
+            }
+        }
+        return added == STATIC_ITEMS && released && same && SetStorage::used() == 0;
+    }
+
+    bool set_heap(void)
+    {
+        int32_t items[HEAP_ITEMS];
+        srand(2);
+        for (auto& item : items)
+        {
+            item = rand() % (HEAP_ITEMS / 2);
+        }
+
+        Collection::OrderedSet<int32_t> ranged{ };
+        Collection::OrderedSet<int32_t> sequential{ };
+        uint16_t added{ };
+        for (auto item : items)
+        {
+            added += sequential.add(item);
+        }
+        return ranged.add_range(items, HEAP_ITEMS) == added && same_sets(ranged, sequential);
+    }
+
+    bool set_no_default(void)
+    {
+        Collection::OrderedSet<Reading> ranged{ };
+        Collection::OrderedSet<Reading> sequential{ };
+        ranged.add(Reading{ 50 });
+        sequential.add(Reading{ 50 });
+        Reading items[]{ Reading{ 70 }, Reading{ 10 }, Reading{ 50 }, Reading{ 60 }, Reading{ 10 }, Reading{ 20 } };
+        uint16_t added{ };
+        for (const auto& item : items)
+        {
+            added += sequential.add(item);
+        }
+        return ranged.add_range(items, 6) == added && added == 4 && same_sets(ranged, sequential);
+    }
+
+    bool map_static(void)
+    {
+        int32_t keys[HEAP_ITEMS / 8];
+        int32_t values[HEAP_ITEMS / 8];
+        srand(3);
+        for (uint16_t index = 0; index < HEAP_ITEMS / 8; index++)
+        {
+            keys[index] = rand() % 64;
+            values[index] = index;
+        }
+
+        bool same{ };
+        {
+            Collection::ArrayMap<int32_t, int32_t, MapStorage> ranged{ };
+            auto added = ranged.add_range(keys, values, HEAP_ITEMS / 8);
+            Collection::ArrayMap<int32_t, int32_t> sequential{ };
+            uint16_t expected{ };
+            for (uint16_t index = 0; index < HEAP_ITEMS / 8; index++)
+            {
+                expected += sequential.add(keys[index], values[index]);
+            }
+            same = added == expected && ranged.size() == sequential.size();
+            for (uint16_t index = 0; same && index < ranged.size(); index++)
+            {
+                same = ranged.key_at(index) == sequential.key_at(index)
+                        && ranged.value_at(index) == sequential.value_at(index);
+            }
+        }
+        return same && MapStorage::used() == 0;
+    }
+
+    bool check(const char* name, bool (*scenario)(void))
+    {
+        auto ok = scenario();
+        printf("  %-16s %s\n", name, ok ? "ok" : "FAILED");
+        return ok;
+    }
+}
+
+int main(void)
+{
+    printf("add_range() against add()\n");
+    bool ok{ true };
+    ok = check("set static", set_static) && ok;
+    ok = check("set heap", set_heap) && ok;
+    ok = check("set no default", set_no_default) && ok;
+    ok = check("map static", map_static) && ok;
+    return ok ? 0 : 1;
+}
\ No newline at end of file
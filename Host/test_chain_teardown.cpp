@@ -0,0 +1,148 @@
+/*
+ * ----------------------------------------------------------------------------
+ * test_chain_teardown
+ * Frees linked collections of a million items in constant stack space.
+ * Part of the ArduinoLibraries project, to be used with any Arduino board.
+ * <https://github.com/Pierrolefou881/ArduinoLibraries>
+ * ----------------------------------------------------------------------------
+ *
+ * Copyright (C) 2025  Pierre DEBAS
+ * <dpierre394@gmail.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+// Each scenario runs on a thread limited to a 64 KiB stack: a teardown
+// recursing once per item would need tens of megabytes and crash.
+#include <Memory.hpp>
+#include <LinkedList.hpp>
+#include <Queue.hpp>
+#include <Stack.hpp>
+#include <pthread.h>
+#include <stdio.h>
+#include <stdint.h>
+
+namespace
+{
+    const uint32_t ITEMS{ 1000000 };
+    const size_t STACK_SIZE{ 64 * 1024 };
+
+    bool list_destroyed(void)
+    {
+        auto list = new Collection::LinkedList<char>{ };
+        for (uint32_t item = 0; item < ITEMS; item++)
+        {
+            list->append('x');
+        }
+        delete list;
+        return true;
+    }
+
+    bool list_cleared(void)
+    {
+        Collection::LinkedList<char> list{ };
+        for (uint32_t item = 0; item < ITEMS; item++)
+        {
+            list.append('x');
+        }
+        list.clear();
+        list.append('y');
+        return list.size() == 1 && list.at(0) == 'y';
+    }
+
+    bool stack_destroyed(void)
+    {
+        auto stack = new Collection::Stack<int32_t>{ };
+        for (uint32_t item = 0; item < ITEMS; item++)
+        {
+            stack->push((int32_t) item);
+        }
+        auto top_ok = stack->peek() == (int32_t) ITEMS - 1;
+        delete stack;
+        return top_ok;
+    }
+
+    bool stack_cleared(void)
+    {
+        Collection::Stack<int32_t> stack{ };
+        for (uint32_t item = 0; item < ITEMS; item++)
+        {
+            stack.push((int32_t) item);
+        }
+        stack.clear();
+        auto empty = stack.is_empty();
+        stack.push(7);
+        return empty && stack.pop() == 7 && stack.is_empty();
+    }
+
+    bool queue_destroyed(void)
+    {
+        auto queue = new Collection::Queue<int32_t>{ };
+        for (uint32_t item = 0; item < ITEMS; item++)
+        {
+            queue->push((int32_t) item);
+        }
+        auto head_ok = queue->peek() == 0;
+        delete queue;
+        return head_ok;
+    }
+
+    bool queue_cleared(void)
+    {
+        Collection::Queue<int32_t> queue{ };
+        for (uint32_t item = 0; item < ITEMS; item++)
+        {
+            queue.push((int32_t) item);
+        }
+        queue.clear();
+        auto empty = queue.is_empty() && queue.size() == 0;
+        queue.push(7);
+        return empty && queue.size() == 1 && queue.pop() == 7 && queue.is_empty();
+    }
+
+    void* run(void* scenario)
+    {
+        static bool result{ };
+        result = reinterpret_cast<bool (*)(void)>(scenario)();
+        return &result;
+    }
+
+    // Runs the scenario on a thread with a STACK_SIZE stack.
+    bool run_on_small_stack(const char* name, bool (*scenario)(void))
+    {
+        pthread_attr_t attributes;
+        pthread_attr_init(&attributes);
+        pthread_attr_setstacksize(&attributes, STACK_SIZE);
+        pthread_t thread;
+        void* result{ };
+        auto ok = pthread_create(&thread, &attributes, run, reinterpret_cast<void*>(scenario)) == 0
+                && pthread_join(thread, &result) == 0
+                && *static_cast<bool*>(result);
+        pthread_attr_destroy(&attributes);
+        printf("  %-16s %s\n", name, ok ? "ok" : "FAILED");
+        return ok;
+    }
+}
+
+int main(void)
+{
+    printf("%u list, stack and queue items, %u KiB of stack\n", ITEMS, (unsigned) (STACK_SIZE / 1024));
+    bool ok{ true };
+    ok = run_on_small_stack("list destroyed", list_destroyed) && ok;
+    ok = run_on_small_stack("list cleared", list_cleared) && ok;
+    ok = run_on_small_stack("stack destroyed", stack_destroyed) && ok;
+    ok = run_on_small_stack("stack cleared", stack_cleared) && ok;
+    ok = run_on_small_stack("queue destroyed", queue_destroyed) && ok;
+    ok = run_on_small_stack("queue cleared", queue_cleared) && ok;
+    return ok ? 0 : 1;
+}
\ No newline at end of file
@@ -1,2 +1,12 @@
+#include "src/RefCount.hpp"
+#include "src/Instrumentation.hpp"
 #include "src/S_ptr.hpp"
-#include "src/U_ptr.hpp"
\ No newline at end of file
+#include "src/U_ptr.hpp"
+#include "src/I_ptr.hpp"
+#include "src/Pool.hpp"
+#include "src/Arena.hpp"
+#include "src/Allocator.hpp"
+#include "src/Relocate.hpp"
+#include "src/U_array.hpp"
+#include "src/StaticArray.hpp"
+#include "src/SmallArray.hpp"
\ No newline at end of file
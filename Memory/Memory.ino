@@ -65,6 +65,32 @@ struct DerivedTestObject : public TestObject
   virtual ~DerivedTestObject(void) = default;
 };
 
+struct CountedTestObject : public Memory::RefCounted
+{
+  CountedTestObject(const char* name) : _name{ name }
+  {
+    Serial.print("CREATED\t");
+    Serial.println(name);
+  }
+
+  virtual ~CountedTestObject(void)
+  {
+    Serial.print("DESTROYED\t");
+    Serial.println(_name);
+  }
+
+  const char* _name = "";
+};
+
+struct DerivedCountedTestObject : public CountedTestObject
+{
+  DerivedCountedTestObject(const char* name) : CountedTestObject{ name }
+  {
+    Serial.println("DERIVED");
+  }
+  virtual ~DerivedCountedTestObject(void) = default;
+};
+
 Memory::U_ptr<TestObject> u_test{ };
 Memory::S_ptr<TestObject> s_test{ };
 
@@ -74,8 +100,12 @@ Memory::U_ptr<TestObject> u_derived_param{ };
 Memory::S_ptr<TestObject> s_derived{ };
 Memory::S_ptr<TestObject> s_derived_param{ };
 
+// Test I_ptr conversions from derived to base types.
+Memory::I_ptr<CountedTestObject> i_derived{ };
+
 // #define _TEST_U_PTR
 #define _TEST_S_PTR
+#define _TEST_I_PTR
 
 void setup() {
   // put your setup code here, to run once:
@@ -125,6 +155,19 @@ void setup() {
   s_derived = Memory::make_shared<TestObject, DerivedTestObject>();
   s_derived_param = Memory::make_shared<TestObject, DerivedTestObject>("Zack");
   #endif
+
+  #ifdef _TEST_I_PTR
+  Memory::I_ptr<CountedTestObject> alice = Memory::make_intrusive<DerivedCountedTestObject>("Alice");
+  auto eve = Memory::make_intrusive<DerivedCountedTestObject>("Eve");
+
+  i_derived = eve;
+  Serial.println(eve.count());
+
+  // Alice is destroyed, Eve is now shared by alice and i_derived only.
+  alice = Memory::move(eve);
+  Serial.println(alice.count());
+  Serial.println(eve == nullptr);
+  #endif
 }
 
 void loop() {
@@ -0,0 +1,229 @@
+/*
+ * ----------------------------------------------------------------------------
+ * Allocator
+ * Allocation policies for smart pointers and collections.
+ * Part of the ArduinoLibraries project, to be used with any Arduino board.
+ * <https://github.com/Pierrolefou881/ArduinoLibraries>
+ * ----------------------------------------------------------------------------
+ *
+ * Copyright (C) 2025  Pierre DEBAS
+ * <dpierre394@gmail.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#pragma once
+#include "Utility.hpp"
+#include "ControlBlock.hpp"
+#include <stddef.h>
+#include <stdint.h>
+
+/*
+ * Allocation policies are stateless types, passed as template parameters
+ * to collections or as tags to make_unique and make_shared. They provide
+ * the following static functions:
+ * - void* allocate(size_t size, size_t alignment): returns nullptr on failure.
+ * - void deallocate(void* data): data was returned by allocate().
+ * - bool reallocate(void* data, size_t new_size): tries to resize data in
+ *   place, returns false if data has to move.
+ */
+namespace Memory
+{
+    /**
+     * Allocation policy using the global heap, i.e. new and delete.
+     * Default policy for all collections.
+     */
+    struct HeapAllocator : public AllocatorTag
+    {
+        static void* allocate(size_t size, size_t)
+        {
+            return ::operator new(size);
+        }
+
+        static void deallocate(void* data)
+        {
+            ::operator delete(data);
+        }
+
+        static bool reallocate(void*, size_t)
+        {
+            return false;
+        }
+    };
+
+    /**
+     * Allocation policy working within BYTES of static storage, e.g. to keep
+     * a collection off the heap. Memory is handed out as a stack: the most
+     * recent allocation can grow or shrink in place and is reclaimed upon
+     * release, the whole storage is reclaimed once everything is released.
+     * Best suited for a single array based collection per Tag.
+     * @param Tag any type, distinguishes storages of the same size.
+     * @param BYTES size of the static storage.
+     */
+    template<typename Tag, size_t BYTES>
+    class StaticAllocator : public AllocatorTag
+    {
+    public:
+        static void* allocate(size_t size, size_t alignment)
+        {
+            auto& state = get_state();
+            auto address = reinterpret_cast<uintptr_t>(state.buffer) + state.offset;
+            auto padding = (alignment - address % alignment) % alignment;
+            if (padding + size > BYTES - state.offset)
+            {
+                return nullptr;
+            }
+            state.last = state.buffer + state.offset + padding;
+            state.offset += padding + size;
+            state.live++;
+            return state.last;
+        }
+
+        static void deallocate(void* data)
+        {
+            auto& state = get_state();
+            if (data == nullptr || state.live == 0)
+            {
+                return;
+            }
+
+            state.live--;
+            if (state.live == 0)
+            {
+                state.offset = 0;
+                state.last = nullptr;
+            }
+            else if (data == state.last)
+            {
+                state.offset = state.last - state.buffer;
+                state.last = nullptr;
+            }
+        }
+
+        static bool reallocate(void* data, size_t new_size)
+        {
+            auto& state = get_state();
+            if (data == nullptr || data != state.last 
+                    || new_size > BYTES - (state.last - state.buffer))
+            {
+                return false;
+            }
+            state.offset = state.last - state.buffer + new_size;
+            return true;
+        }
+
+        /**
+         * @return the number of bytes currently reserved.
+         */
+        static size_t used(void)
+        {
+            return get_state().offset;
+        }
+
+    private:
+        // Zero initialized, no construction needed.
+        struct State
+        {
+            uint8_t buffer[BYTES];
+            uint8_t* last;
+            size_t offset;
+            uint16_t live;
+        };
+
+        static State& get_state(void)
+        {
+            static State state;
+            return state;
+        }
+    };
+
+    /**
+     * Deletion policy for objects created with an allocation policy.
+     * @param A allocation policy the object was created with.
+     * @param U type of the created object.
+     */
+    template<typename A, typename U>
+    struct AllocatorDelete
+    {
+        /**
+         * Destroys the provided object and gives its memory back to A.
+         * @param T U or a base type of U.
+         * @param data can be nullptr.
+         */
+        template<typename T>
+        void operator ()(T* data) const
+        {
+            if (data != nullptr)
+            {
+                auto object = static_cast<U*>(data);
+                untrack(object);
+                object->~U();
+                A::deallocate(object);
+            }
+        }
+    };
+
+    /**
+     * ControlBlock holding a shared object and its reference count within
+     * a single allocation made by an allocation policy.
+     * @param T type of the shared object.
+     * @param A allocation policy.
+     */
+    template<typename T, typename A>
+    class AllocatorControlBlock : public ControlBlock
+    {
+    public:
+        /**
+         * Initializes this AllocatorControlBlock and its object with the
+         * provided parameters.
+         * @param args must match one of T's constructors.
+         */
+        template<class... Args>
+        AllocatorControlBlock(Args&&... args) : _data{ Memory::forward<Args>(args)... }
+        {
+            // Empty body.
+        }
+
+        virtual ~AllocatorControlBlock(void) = default;
+
+        /**
+         * @return the address of the managed object.
+         */
+        T* get(void) { return &_data; }
+
+        /**
+         * Destroys the managed object and gives the memory back to A.
+         */
+        void release(void) override
+        {
+            AllocatorDelete<A, AllocatorControlBlock<T, A>>{ }(this);
+        }
+
+    private:
+        T _data;
+    };
+
+    /**
+     * Creates an instance of T with the provided allocation policy.
+     * @param T type to instantiate.
+     * @param A allocation policy.
+     * @param args must match one of T's constructors.
+     * @return the new instance, nullptr if A ran out of memory.
+     */
+    template<typename T, typename A, class... Args>
+    T* create(Args&&... args)
+    {
+        auto memory = A::allocate(sizeof(T), alignof(T));
+        return memory == nullptr ? nullptr : track(new (memory) T{ Memory::forward<Args>(args)... });
+    }
+}
\ No newline at end of file
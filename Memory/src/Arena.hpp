@@ -0,0 +1,156 @@
+/*
+ * ----------------------------------------------------------------------------
+ * Arena
+ * Monotonic bump allocator with scoped reset.
+ * Part of the ArduinoLibraries project, to be used with any Arduino board.
+ * <https://github.com/Pierrolefou881/ArduinoLibraries>
+ * ----------------------------------------------------------------------------
+ *
+ * Copyright (C) 2025  Pierre DEBAS
+ * <dpierre394@gmail.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#pragma once
+#include "Utility.hpp"
+#include <stddef.h>
+#include <stdint.h>
+
+namespace Memory
+{
+    /**
+     * Monotonic allocator working within a caller provided buffer.
+     * Allocation only moves a cursor forward and objects are never
+     * freed one by one: the whole Arena is rewound at once, usually
+     * by an ArenaScope at the end of loop(). Well suited for short
+     * lived temporaries such as iterators.
+     * Objects allocated within an Arena may still be held by smart
+     * pointers with ArenaDelete, which only calls the destructor.
+     * They must not outlive the ArenaScope they were created in.
+     */
+    class Arena : public AllocatorTag
+    {
+    public:
+        /**
+         * Initializes this Arena upon the provided buffer.
+         * @param buffer must outlive this Arena.
+         * @param capacity size of buffer in bytes.
+         */
+        Arena(uint8_t* buffer, size_t capacity)
+            : _buffer{ buffer }, _capacity{ capacity }
+        {
+            // Empty body.
+        }
+
+        Arena(const Arena&) = delete;
+        Arena& operator =(const Arena&) = delete;
+
+        /**
+         * Reserves memory within this Arena.
+         * @param size in bytes of the requested memory.
+         * @param alignment of the requested memory. Must be a power of 2.
+         * @return the address of the reserved memory, or nullptr if this
+         *         Arena has not enough room left.
+         */
+        void* allocate(size_t size, size_t alignment)
+        {
+            auto address = reinterpret_cast<uintptr_t>(_buffer) + _offset;
+            auto padding = (alignment - address % alignment) % alignment;
+            if (padding + size > _capacity - _offset)
+            {
+                return nullptr;
+            }
+            _offset += padding + size;
+            return reinterpret_cast<void*>(address + padding);
+        }
+
+        /**
+         * Frees all memory of this Arena at once. Objects allocated within
+         * must have been destroyed beforehand.
+         */
+        void reset(void) { _offset = 0; }
+
+        /**
+         * @return the number of bytes in use.
+         */
+        size_t used(void) const { return _offset; }
+
+        /**
+         * @return the size of the buffer in bytes.
+         */
+        size_t capacity(void) const { return _capacity; }
+
+        /**
+         * @return true if the provided address lies within this Arena.
+         */
+        bool owns(const void* data) const
+        {
+            auto address = static_cast<const uint8_t*>(data);
+            return address >= _buffer && address < _buffer + _capacity;
+        }
+
+        /**
+         * @return the Arena of the innermost ArenaScope, nullptr if there is
+         *         no ArenaScope alive.
+         */
+        static Arena* active(void) { return current(); }
+
+        friend class ArenaScope;
+
+    private:
+        uint8_t* _buffer{ };
+        size_t _capacity{ };
+        size_t _offset{ };
+
+        static Arena*& current(void)
+        {
+            static Arena* arena{ };
+            return arena;
+        }
+    };
+
+    /**
+     * Activates an Arena for its lifetime. While alive, make_scoped
+     * allocates within said Arena. Upon destruction, frees everything
+     * allocated in the Arena since its construction and restores the
+     * previously active Arena, if any. ArenaScopes can be nested.
+     */
+    class ArenaScope
+    {
+    public:
+        /**
+         * Activates the provided Arena.
+         * @param arena must outlive this ArenaScope.
+         */
+        ArenaScope(Arena& arena) 
+            : _arena{ arena }, _previous{ Arena::current() }, _mark{ arena._offset }
+        {
+            Arena::current() = &arena;
+        }
+
+        ~ArenaScope(void)
+        {
+            _arena._offset = _mark;
+            Arena::current() = _previous;
+        }
+
+        ArenaScope(const ArenaScope&) = delete;
+        ArenaScope& operator =(const ArenaScope&) = delete;
+
+    private:
+        Arena& _arena;
+        Arena* _previous{ };
+        size_t _mark{ };
+    };
+}
\ No newline at end of file
@@ -0,0 +1,159 @@
+/*
+ * ----------------------------------------------------------------------------
+ * ControlBlock
+ * Reference counting bookkeeping shared between S_ptr instances.
+ * Part of the ArduinoLibraries project, to be used with any Arduino board.
+ * <https://github.com/Pierrolefou881/ArduinoLibraries>
+ * ----------------------------------------------------------------------------
+ *
+ * Copyright (C) 2025  Pierre DEBAS
+ * <dpierre394@gmail.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#pragma once
+#include "Deleter.hpp"
+#include "RefCount.hpp"
+#include "Utility.hpp"
+#include <stdint.h>
+
+namespace Memory
+{
+    /**
+     * Holds the reference count of an object shared by several
+     * S_ptr instances and knows how to dispose of it. The count is
+     * updated according to the RefCount policy. Concrete
+     * blocks define where the shared object lives.
+     */
+    class ControlBlock
+    {
+    public:
+        virtual ~ControlBlock(void) = default;
+
+        /**
+         * @return the number of active references to the managed object.
+         */
+        uint16_t count(void) const { return _count.load(); }
+
+        /**
+         * Registers a new reference to the managed object.
+         */
+        void increase(void) { _count.increase(); }
+
+        /**
+         * Unregisters a reference to the managed object.
+         * @return true if it was the last reference, false otherwise.
+         */
+        bool decrease(void) { return _count.decrease(); }
+
+        /**
+         * Destroys the managed object and frees this ControlBlock.
+         * Must be called only once the count dropped to 0.
+         */
+        virtual void release(void) = 0;
+
+    protected:
+        /**
+         * Initializes this ControlBlock with a single reference.
+         */
+        ControlBlock(void) = default;
+
+    private:
+        RefCount _count{ 1 };
+    };
+
+    /**
+     * ControlBlock adopting an object allocated elsewhere, e.g. a
+     * pointer obtained with new and handed over to a S_ptr.
+     * @param T can be any type.
+     * @param D deletion policy, called upon the adopted object once the
+     *          count dropped to 0. Takes no room if stateless.
+     *          DefaultDelete<T> by default.
+     */
+    template<typename T, typename D = DefaultDelete<T>>
+    class PointerControlBlock : public ControlBlock, private DeleterHolder<D>
+    {
+    public:
+        /**
+         * Initializes this PointerControlBlock with the object to manage.
+         * @param data must not be nullptr.
+         * @param deleter to release data with.
+         */
+        PointerControlBlock(T* data, const D& deleter = D{ }) 
+            : DeleterHolder<D>{ deleter }
+            , _data{ data }
+        {
+            // Empty body.
+        }
+
+        virtual ~PointerControlBlock(void) = default;
+
+        /**
+         * Releases the adopted object with the deletion policy, then
+         * deletes this PointerControlBlock.
+         */
+        void release(void) override
+        {
+            untrack(_data);
+            untrack(this);
+            DeleterHolder<D>::get_deleter()(_data);
+            delete this;
+        }
+
+    private:
+        T* _data{ };
+    };
+
+    /**
+     * ControlBlock holding the managed object itself, so that both
+     * the object and its reference count come from a single allocation.
+     * Used by make_shared, upon the heap or within an Arena.
+     * @param T can be any type.
+     * @param D deletion policy template releasing this block, DefaultDelete
+     *          by default, ArenaDelete within an Arena.
+     */
+    template<typename T, template<typename> class D = DefaultDelete>
+    class InlineControlBlock : public ControlBlock
+    {
+    public:
+        /**
+         * Initializes this InlineControlBlock and its object with the
+         * provided parameters.
+         * @param args must match one of T's constructors.
+         */
+        template<class... Args>
+        InlineControlBlock(Args&&... args) : _data{ Memory::forward<Args>(args)... }
+        {
+            // Empty body.
+        }
+
+        virtual ~InlineControlBlock(void) = default;
+
+        /**
+         * @return the address of the managed object.
+         */
+        T* get(void) { return &_data; }
+
+        /**
+         * Destroys the managed object along with this InlineControlBlock.
+         */
+        void release(void) override
+        {
+            D<InlineControlBlock<T, D>>{ }(this);
+        }
+
+    private:
+        T _data;
+    };
+}
\ No newline at end of file
@@ -0,0 +1,168 @@
+/*
+ * ----------------------------------------------------------------------------
+ * Deleter
+ * Deletion policies for smart pointers.
+ * Part of the ArduinoLibraries project, to be used with any Arduino board.
+ * <https://github.com/Pierrolefou881/ArduinoLibraries>
+ * ----------------------------------------------------------------------------
+ *
+ * Copyright (C) 2025  Pierre DEBAS
+ * <dpierre394@gmail.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#pragma once
+#include "Instrumentation.hpp"
+#include "Utility.hpp"
+
+namespace Memory
+{
+    /**
+     * Default deletion policy for smart pointers. Releases objects
+     * allocated with new.
+     * @param T can be any type.
+     */
+    template<typename T>
+    struct DefaultDelete
+    {
+        DefaultDelete(void) = default;
+
+        /**
+         * Initializes this DefaultDelete from the one of a derived type, so
+         * that smart pointers to a derived type convert to a base type.
+         * @param U derived type of T.
+         */
+        template<typename U, typename = typename EnableIf<IsConvertible<U*, T*>::value>::type>
+        DefaultDelete(const DefaultDelete<U>&)
+        {
+            // Empty body.
+        }
+
+        /**
+         * Deletes the provided object.
+         * @param data can be nullptr.
+         */
+        void operator ()(T* data) const
+        {
+            untrack(data);
+            delete data;
+        }
+    };
+
+    /**
+     * Deletion policy for objects that make_unique and make_scoped may
+     * place within an Arena. Such objects are only destroyed, their memory
+     * being freed along with the whole Arena. Objects that make_scoped had
+     * to allocate upon the heap are deleted.
+     * @param T can be any type.
+     */
+    template<typename T>
+    class ArenaDelete
+    {
+    public:
+        /**
+         * Initializes this ArenaDelete.
+         * @param in_arena false if the objects to delete come from new.
+         */
+        ArenaDelete(bool in_arena = true) : _in_arena{ in_arena }
+        {
+            // Empty body.
+        }
+
+        /**
+         * Initializes this ArenaDelete from the one of a derived type, so
+         * that smart pointers to a derived type convert to a base type.
+         * @param U derived type of T.
+         * @param other to copy.
+         */
+        template<typename U, typename = typename EnableIf<IsConvertible<U*, T*>::value>::type>
+        ArenaDelete(const ArenaDelete<U>& other) : _in_arena{ other.in_arena() }
+        {
+            // Empty body.
+        }
+
+        /**
+         * @return true if the objects to delete live within an Arena.
+         */
+        bool in_arena(void) const { return _in_arena; }
+
+        /**
+         * Destroys the provided object, and frees its memory unless it
+         * lives within an Arena.
+         * @param data can be nullptr.
+         */
+        void operator ()(T* data) const
+        {
+            untrack(data);
+            if (!_in_arena)
+            {
+                delete data;
+            }
+            else if (data != nullptr)
+            {
+                data->~T();
+            }
+        }
+
+    private:
+        bool _in_arena{ true };
+    };
+
+    /**
+     * Stores a deletion policy on behalf of a smart pointer or a ControlBlock.
+     * Stateless policies are inherited from, so that they take no room
+     * (empty base optimization). Other ones, e.g. function pointers, are
+     * stored as members.
+     * @param D deletion policy, callable with a pointer to delete.
+     */
+    template<typename D, bool STATELESS = __is_empty(D) && !__is_final(D)>
+    class DeleterHolder
+    {
+    public:
+        DeleterHolder(void) = default;
+
+        /**
+         * Initializes this DeleterHolder with the provided deletion policy.
+         * @param deleter to copy.
+         */
+        DeleterHolder(const D& deleter) : _deleter{ deleter }
+        {
+            // Empty body.
+        }
+
+        /**
+         * @return the stored deletion policy.
+         */
+        D& get_deleter(void) { return _deleter; }
+        const D& get_deleter(void) const { return _deleter; }
+
+    private:
+        D _deleter{ };
+    };
+
+    template<typename D>
+    class DeleterHolder<D, true> : private D
+    {
+    public:
+        DeleterHolder(void) = default;
+
+        DeleterHolder(const D& deleter) : D{ deleter }
+        {
+            // Empty body.
+        }
+
+        D& get_deleter(void) { return *this; }
+        const D& get_deleter(void) const { return *this; }
+    };
+}
\ No newline at end of file
@@ -0,0 +1,259 @@
+/*
+ * ----------------------------------------------------------------------------
+ * I_ptr
+ * Custom implementation of intrusive shared pointer for Arduino.
+ * Part of the ArduinoLibraries project, to be used with any Arduino board.
+ * <https://github.com/Pierrolefou881/ArduinoLibraries>
+ * ----------------------------------------------------------------------------
+ *
+ * Copyright (C) 2025  Pierre DEBAS
+ * <dpierre394@gmail.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#pragma once
+#include "RefCounted.hpp"
+#include "Deleter.hpp"
+#include "Utility.hpp"
+#include <stdint.h>
+
+namespace Memory
+{
+    /**
+     * Shared pointer for types deriving from RefCounted. The reference
+     * count is stored within the pointed object, so an I_ptr is exactly
+     * as wide as a raw pointer and sharing needs no extra allocation.
+     * Deallocates the pointed object when the last I_ptr releases it.
+     * @param T must derive from RefCounted.
+     * @param D deletion policy, called upon the pointed object when its
+     *          last I_ptr releases it. Must be default constructible.
+     *          Uses delete by default.
+     */
+    template<typename T, typename D = DefaultDelete<T>>
+    class I_ptr
+    {
+    public:
+        /**
+         * Initializes this I_ptr as nullptr.
+         */
+        I_ptr(void) = default;
+
+        /**
+         * Initializes this I_ptr with the provided pointer to data. If data not null,
+         * increases its reference count.
+         * @param data pointer. Can be nullptr.
+         */
+        I_ptr(T* data) : _data{ data }
+        {
+            acquire();
+        }
+
+        I_ptr(const I_ptr& other) : _data{ other._data }
+        {
+            acquire();
+        }
+
+        I_ptr(I_ptr&& other) noexcept : _data{ other._data }
+        {
+            other._data = nullptr;
+        }
+
+        /**
+         * Initializes this I_ptr from an I_ptr to a derived type, whose
+         * deletion policy converts to D, e.g. DefaultDelete<U>.
+         * CAUTION: T must declare a virtual destructor if D deletes
+         *          through a pointer to T.
+         * @param U derived type of T.
+         * @param E deletion policy of other.
+         * @param other can be nullptr.
+         */
+        template<typename U, typename E, typename = typename EnableIf<IsConvertible<U*, T*>::value && IsConvertible<E, D>::value>::type>
+        I_ptr(const I_ptr<U, E>& other) : _data{ other.get() }
+        {
+            acquire();
+        }
+
+        template<typename U, typename E, typename = typename EnableIf<IsConvertible<U*, T*>::value && IsConvertible<E, D>::value>::type>
+        I_ptr(I_ptr<U, E>&& other) noexcept : _data{ other._data }
+        {
+            other._data = nullptr;
+        }
+
+        ~I_ptr(void)
+        {
+            release();
+        }
+
+        /**
+         * @return the pointed object as a raw pointer.
+         */
+        T* get(void) const { return _data; }
+
+        /**
+         * @return the number of active references to the pointed object.
+         */
+        uint16_t count(void) const
+        {
+            return _data == nullptr ? 0 : _data->RefCounted::ref_count();
+        }
+
+        T& operator *(void) const { return *_data; }
+        T* operator ->(void) const { return _data; }
+
+        I_ptr& operator =(T* data_ptr)
+        {
+            if (data_ptr != _data)
+            {
+                auto old = _data;
+                _data = data_ptr;
+                acquire();
+                release(old);
+            }
+            return *this;
+        }
+
+        I_ptr& operator =(const I_ptr& other)
+        {
+            return *this = other._data;
+        }
+
+        I_ptr& operator =(I_ptr&& other) noexcept
+        {
+            if (other._data != _data)
+            {
+                auto old = _data;
+                _data = other._data;
+                other._data = nullptr;
+                release(old);
+            }
+            return *this;
+        }
+
+        template<typename U, typename E>
+        typename EnableIf<IsConvertible<U*, T*>::value && IsConvertible<E, D>::value, I_ptr&>::type 
+        operator =(const I_ptr<U, E>& other)
+        {
+            return *this = static_cast<T*>(other.get());
+        }
+
+        template<typename U, typename E>
+        typename EnableIf<IsConvertible<U*, T*>::value && IsConvertible<E, D>::value, I_ptr&>::type 
+        operator =(I_ptr<U, E>&& other) noexcept
+        {
+            T* data{ other._data };
+            other._data = nullptr;
+            if (data != _data)
+            {
+                auto old = _data;
+                _data = data;
+                release(old);
+            }
+            else
+            {
+                release(data);
+            }
+            return *this;
+        }
+
+        friend bool operator ==(const I_ptr& a, const I_ptr& b) { return a._data == b._data; }
+        friend bool operator !=(const I_ptr& a, const I_ptr& b) { return a._data != b._data; }
+        friend bool operator ==(const I_ptr& ip, const T* p) { return ip._data == p; }
+        friend bool operator ==(const T* p, const I_ptr& ip) { return ip._data == p; }
+        friend bool operator !=(const I_ptr& ip, const T* p) { return ip._data != p; }
+        friend bool operator !=(const T* p, const I_ptr& ip) { return ip._data != p; }
+        friend bool operator ==(const I_ptr& ip, const T& other) { return *ip == other; }
+        friend bool operator ==(const T& other, const I_ptr& ip) { return *ip == other; }
+
+    private:
+        template<typename U, typename E>
+        friend class I_ptr;
+
+        T* _data{ };
+
+        void acquire(void)
+        {
+            if (_data != nullptr)
+            {
+                _data->RefCounted::increase_ref_count();
+            }
+        }
+
+        void release(void)
+        {
+            auto tmp = _data;
+            _data = nullptr;
+            release(tmp);
+        }
+
+        static void release(T* data)
+        {
+            if (data != nullptr && data->RefCounted::decrease_ref_count())
+            {
+                D{ }(data);
+            }
+        }
+    };
+
+    // Locks the size in: the count lives within the pointed object.
+    static_assert(sizeof(I_ptr<RefCounted>) == sizeof(RefCounted*), "I_ptr must be pointer sized");
+
+    /**
+     * @return an I_ptr pointing to a default instance of T.
+     */
+    template<typename T>
+    I_ptr<T> make_intrusive(void)
+    {
+        return { track(new T{ }) };
+    }
+
+    /**
+     * Creates an I_ptr pointing to an instance of T created with
+     * provided parameters.
+     * @param args must match any parameterized constructor of T.
+     * @return an I_ptr instance pointing to the newly created instance of T.
+     */
+    template<typename T, class... Args>
+    I_ptr<T> make_intrusive(Args&&... args)
+    {
+        return { track(new T{ Memory::forward<Args>(args)... }) };
+    }
+
+    /**
+     * Creates a new instance of I_ptr<T> holding a default initialized
+     * instance of U.
+     * @param T must derive from RefCounted.
+     * @param U is a derived type of T.
+     * @return a new I_ptr<T> wrapping the newly instanced U.
+     */
+    template<typename T, typename U>
+    I_ptr<T> make_intrusive(void)
+    {
+        return { track(new U{ }) };
+    }
+
+    /**
+     * Creates a new instance of I_ptr<T> holding an instance of U initialized
+     * with given parameters.
+     * @param T must derive from RefCounted.
+     * @param U is a derived type of T.
+     * @param Args types of arguments.
+     * @param args must match one of U's parameterized constructors.
+     * @return a new I_ptr<T> wrapping the newly instanced U.
+     */
+    template<typename T, typename U, class... Args>
+    I_ptr<T> make_intrusive(Args&&... args)
+    {
+        return { track(new U{ Memory::forward<Args>(args)... }) };
+    }
+}
\ No newline at end of file
@@ -0,0 +1,399 @@
+/*
+ * ----------------------------------------------------------------------------
+ * Instrumentation
+ * Opt-in allocation statistics and leak report for Memory.
+ * Part of the ArduinoLibraries project, to be used with any Arduino board.
+ * <https://github.com/Pierrolefou881/ArduinoLibraries>
+ * ----------------------------------------------------------------------------
+ *
+ * Copyright (C) 2025  Pierre DEBAS
+ * <dpierre394@gmail.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#pragma once
+#include <stddef.h>
+#include <stdint.h>
+
+#if defined(MEMORY_INSTRUMENTATION)
+#include <stdlib.h>
+#if !defined(ARDUINO)
+#include <stdio.h>
+#include <string.h>
+#endif
+#endif
+
+/*
+ * Defining MEMORY_INSTRUMENTATION before including Memory.hpp records every
+ * object and array created by make_unique, make_shared, make_intrusive,
+ * make_scoped, S_ptr(T*), create and U_array, whatever the allocation
+ * policy. Bookkeeping uses malloc, so it never shows in the statistics.
+ * Without MEMORY_INSTRUMENTATION, track() and untrack() compile to nothing.
+ */
+namespace Memory
+{
+    /**
+     * Allocation statistics of a single type.
+     */
+    struct AllocationRecord
+    {
+        const char* type{ };            // Signature naming the type.
+        const void* call_site{ };       // Return address of the latest allocation.
+        uint32_t live_count{ };
+        uint32_t total_count{ };
+        size_t live_bytes{ };
+        size_t total_bytes{ };
+        size_t peak_bytes{ };
+        AllocationRecord* next{ };
+    };
+
+#if defined(MEMORY_INSTRUMENTATION)
+    /**
+     * Keeps one AllocationRecord per allocated type, along with the size
+     * and type of every live allocation. On hosts, the report is printed
+     * upon exit to stderr. Call sites are return addresses: build with
+     * -fno-inline for exact sites, then resolve them with addr2line.
+     */
+    class Instrumentation
+    {
+    public:
+        /**
+         * @return the first AllocationRecord, nullptr if nothing was
+         *         allocated yet. Records are chained through next.
+         */
+        static AllocationRecord* first(void)
+        {
+            return get_state().records;
+        }
+
+        /**
+         * @return the number of bytes currently allocated, all types included.
+         */
+        static size_t live_bytes(void)
+        {
+            return get_state().live_bytes;
+        }
+
+        /**
+         * @return the highest number of bytes allocated at once, all types
+         *         included.
+         */
+        static size_t peak_bytes(void)
+        {
+            return get_state().peak_bytes;
+        }
+
+        /**
+         * @param T any type.
+         * @return the AllocationRecord of T.
+         */
+        template<typename T>
+        static AllocationRecord& record(void)
+        {
+            static AllocationRecord* record{ create_record(__PRETTY_FUNCTION__) };
+            return *record;
+        }
+
+        /**
+         * Registers a new allocation.
+         * @param record of the allocated type.
+         * @param data address of the allocation. Must not be nullptr.
+         * @param bytes size of the allocation.
+         * @param call_site address the allocation was requested from.
+         */
+        static void allocate(AllocationRecord& record, const void* data, size_t bytes, const void* call_site)
+        {
+            auto entry = static_cast<Entry*>(malloc(sizeof(Entry)));
+            if (entry == nullptr)
+            {
+                return;
+            }
+
+            Lock lock{ };
+            auto& state = get_state();
+            auto& bucket = state.buckets[hash(data)];
+            *entry = Entry{ data, bytes, &record, bucket };
+            bucket = entry;
+
+            record.call_site = call_site;
+            record.live_count++;
+            record.total_count++;
+            record.live_bytes += bytes;
+            record.total_bytes += bytes;
+            if (record.live_bytes > record.peak_bytes)
+            {
+                record.peak_bytes = record.live_bytes;
+            }
+
+            state.live_bytes += bytes;
+            if (state.live_bytes > state.peak_bytes)
+            {
+                state.peak_bytes = state.live_bytes;
+            }
+        }
+
+        /**
+         * Unregisters an allocation. Unknown addresses are ignored.
+         * @param data address of the allocation.
+         */
+        static void release(const void* data)
+        {
+            Lock lock{ };
+            auto& state = get_state();
+            auto link = &state.buckets[hash(data)];
+            while (*link != nullptr && (*link)->data != data)
+            {
+                link = &(*link)->next;
+            }
+
+            auto entry = *link;
+            if (entry == nullptr)
+            {
+                return;
+            }
+            *link = entry->next;
+            entry->record->live_count--;
+            entry->record->live_bytes -= entry->bytes;
+            state.live_bytes -= entry->bytes;
+            free(entry);
+        }
+
+        /**
+         * Updates the size of an allocation resized in place.
+         * @param data address of the allocation.
+         * @param bytes new size of the allocation.
+         */
+        static void resize(const void* data, size_t bytes)
+        {
+            Lock lock{ };
+            auto& state = get_state();
+            auto entry = state.buckets[hash(data)];
+            while (entry != nullptr && entry->data != data)
+            {
+                entry = entry->next;
+            }
+            if (entry == nullptr)
+            {
+                return;
+            }
+
+            auto& record = *entry->record;
+            record.live_bytes += bytes - entry->bytes;
+            state.live_bytes += bytes - entry->bytes;
+            if (bytes > entry->bytes)
+            {
+                record.total_bytes += bytes - entry->bytes;
+            }
+            entry->bytes = bytes;
+            if (record.live_bytes > record.peak_bytes)
+            {
+                record.peak_bytes = record.live_bytes;
+            }
+            if (state.live_bytes > state.peak_bytes)
+            {
+                state.peak_bytes = state.live_bytes;
+            }
+        }
+
+#if !defined(ARDUINO)
+        /**
+         * Prints the statistics of every type, then the leaks, i.e. types
+         * with live allocations.
+         * @param output stream to print to.
+         */
+        static void report(FILE* output)
+        {
+            fprintf(output, "Memory: peak %zu bytes, live %zu bytes\n", peak_bytes(), live_bytes());
+            fprintf(output, "%10s %10s %12s %12s  type\n", "live", "total", "peak bytes", "live bytes");
+            for (auto record = first(); record != nullptr; record = record->next)
+            {
+                fprintf(output, "%10lu %10lu %12zu %12zu  ", 
+                        (unsigned long) record->live_count, (unsigned long) record->total_count,
+                        record->peak_bytes, record->live_bytes);
+                print_type(output, record->type);
+            }
+            for (auto record = first(); record != nullptr; record = record->next)
+            {
+                if (record->live_count > 0)
+                {
+                    fprintf(output, "LEAK: %lu object(s), %zu bytes, last allocated from %p: ", 
+                            (unsigned long) record->live_count, record->live_bytes, record->call_site);
+                    print_type(output, record->type);
+                }
+            }
+        }
+#endif
+
+    private:
+        static const uint16_t BUCKETS{ 256 };
+
+        struct Entry
+        {
+            const void* data;
+            size_t bytes;
+            AllocationRecord* record;
+            Entry* next;
+        };
+
+        // Zero initialized, no construction needed.
+        struct State
+        {
+            AllocationRecord* records;
+            Entry* buckets[BUCKETS];
+            size_t live_bytes;
+            size_t peak_bytes;
+            bool lock;
+        };
+
+        // Guards bookkeeping against concurrent threads on hosts.
+        class Lock
+        {
+        public:
+            Lock(void)
+            {
+#if !defined(__AVR__)
+                while (__atomic_test_and_set(&get_state().lock, __ATOMIC_ACQUIRE))
+                {
+                    // Spin.
+                }
+#endif
+            }
+
+            ~Lock(void)
+            {
+#if !defined(__AVR__)
+                __atomic_clear(&get_state().lock, __ATOMIC_RELEASE);
+#endif
+            }
+        };
+
+        static State& get_state(void)
+        {
+            static State state;
+            return state;
+        }
+
+        static uint16_t hash(const void* data)
+        {
+            auto address = reinterpret_cast<uintptr_t>(data);
+            return (address >> 4 ^ address >> 12) % BUCKETS;
+        }
+
+        static AllocationRecord* create_record(const char* type)
+        {
+            auto record = static_cast<AllocationRecord*>(malloc(sizeof(AllocationRecord)));
+            if (record == nullptr)
+            {
+                // Statistics of this type are lost, but still consistent.
+                static AllocationRecord overflow{ };
+                return &overflow;
+            }
+
+            Lock lock{ };
+            auto& state = get_state();
+            *record = AllocationRecord{ };
+            record->type = type;
+            record->next = state.records;
+            if (state.records == nullptr)
+            {
+#if !defined(ARDUINO)
+                atexit(report_at_exit);
+#endif
+            }
+            state.records = record;
+            return record;
+        }
+
+#if !defined(ARDUINO)
+        static void report_at_exit(void)
+        {
+            report(stderr);
+        }
+
+        // Prints the type out of a signature ending with "[with T = type]".
+        static void print_type(FILE* output, const char* signature)
+        {
+            auto type = strstr(signature, "T = ");
+            if (type == nullptr)
+            {
+                fprintf(output, "%s\n", signature);
+                return;
+            }
+            type += 4;
+            auto end = strchr(type, ';');
+            auto length = end != nullptr ? end - type : strlen(type) - 1;
+            fprintf(output, "%.*s\n", (int) length, type);
+        }
+#endif
+    };
+#endif
+
+    /**
+     * Registers a new allocation of T, along with the address it was
+     * requested from. Does nothing unless MEMORY_INSTRUMENTATION is defined.
+     * @param T type of the allocated object.
+     * @param data allocated object. Can be nullptr.
+     * @param bytes size of the allocation. sizeof(T) by default.
+     * @return data.
+     */
+    template<typename T>
+    __attribute__((always_inline)) inline T* track(T* data, size_t bytes = sizeof(T))
+    {
+#if defined(MEMORY_INSTRUMENTATION)
+        if (data != nullptr)
+        {
+            Instrumentation::allocate(Instrumentation::record<T>(), data, bytes, __builtin_return_address(0));
+        }
+#else
+        (void) bytes;
+#endif
+        return data;
+    }
+
+    /**
+     * Unregisters an allocation made with track(). Does nothing unless
+     * MEMORY_INSTRUMENTATION is defined.
+     * @param data can be nullptr.
+     */
+    inline void untrack(const void* data)
+    {
+#if defined(MEMORY_INSTRUMENTATION)
+        if (data != nullptr)
+        {
+            Instrumentation::release(data);
+        }
+#else
+        (void) data;
+#endif
+    }
+
+    /**
+     * Updates the size of an allocation made with track() and resized
+     * in place. Does nothing unless MEMORY_INSTRUMENTATION is defined.
+     * @param data can be nullptr.
+     * @param bytes new size of the allocation.
+     */
+    inline void track_resize(const void* data, size_t bytes)
+    {
+#if defined(MEMORY_INSTRUMENTATION)
+        if (data != nullptr)
+        {
+            Instrumentation::resize(data, bytes);
+        }
+#else
+        (void) data;
+        (void) bytes;
+#endif
+    }
+}
\ No newline at end of file
@@ -0,0 +1,240 @@
+/*
+ * ----------------------------------------------------------------------------
+ * Pool
+ * Fixed-block pool allocator backed by static storage.
+ * Part of the ArduinoLibraries project, to be used with any Arduino board.
+ * <https://github.com/Pierrolefou881/ArduinoLibraries>
+ * ----------------------------------------------------------------------------
+ *
+ * Copyright (C) 2025  Pierre DEBAS
+ * <dpierre394@gmail.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#pragma once
+#include "Utility.hpp"
+#include "ControlBlock.hpp"
+#include <stdint.h>
+
+namespace Memory
+{
+    // Forward declaration
+    template<typename T, uint16_t N>
+    class PoolControlBlock;
+
+    /**
+     * Allocator giving out N fixed-size blocks from static storage.
+     * Blocks are large enough to hold either a T or a T along with
+     * its S_ptr reference count, so the same Pool serves both
+     * make_unique and make_shared. Freed blocks are recycled, so
+     * the heap is never touched and cannot get fragmented.
+     * A Pool is identified by its type: all instances of Pool<T, N>
+     * share the same storage and can be passed around as tags, e.g.
+     * Memory::make_unique<T>(Memory::Pool<T, 8>{ }, args...).
+     * A Pool is also an allocation policy (see Allocator.hpp) for
+     * linked collections whose links fit within a block.
+     * @param T type of object to allocate.
+     * @param N number of blocks.
+     */
+    template<typename T, uint16_t N>
+    class Pool : public AllocatorTag
+    {
+    public:
+        /**
+         * Takes a free block out of this Pool.
+         * @return the address of the block, or nullptr if this
+         *         Pool is exhausted.
+         */
+        static void* allocate(void)
+        {
+            auto& state = get_state();
+            if (state.free_list != nullptr)
+            {
+                auto block = state.free_list;
+                state.free_list = block->next;
+                return block->data;
+            }
+
+            if (state.untouched < N)
+            {
+                return state.blocks[state.untouched++].data;
+            }
+            return nullptr;
+        }
+
+        /**
+         * Gives a block back to this Pool. The object it held must
+         * have been destroyed beforehand.
+         * @param data address returned by allocate(). Can be nullptr.
+         */
+        static void release(void* data)
+        {
+            if (data == nullptr)
+            {
+                return;
+            }
+            auto& state = get_state();
+            auto block = static_cast<Block*>(data);
+            block->next = state.free_list;
+            state.free_list = block;
+        }
+
+        /**
+         * Allocation policy interface, so that a Pool can serve collections.
+         * @param size in bytes of the requested memory.
+         * @param alignment of the requested memory.
+         * @return a free block, nullptr if size or alignment exceed those
+         *         of a block or if this Pool is exhausted.
+         */
+        static void* allocate(size_t size, size_t alignment)
+        {
+            return size <= BLOCK_SIZE && alignment <= alignof(Block) ? allocate() : nullptr;
+        }
+
+        /**
+         * Allocation policy interface, see release().
+         */
+        static void deallocate(void* data)
+        {
+            release(data);
+        }
+
+        /**
+         * Allocation policy interface. Blocks have a fixed size.
+         * @return true if new_size fits within a block.
+         */
+        static bool reallocate(void* data, size_t new_size)
+        {
+            return data != nullptr && new_size <= BLOCK_SIZE;
+        }
+
+        /**
+         * @return true if the provided address is a block of this Pool.
+         */
+        static bool owns(const void* data)
+        {
+            auto& state = get_state();
+            auto address = static_cast<const Block*>(data);
+            return address >= state.blocks && address < state.blocks + N;
+        }
+
+        /**
+         * @return the number of blocks that can still be allocated.
+         */
+        static uint16_t available(void)
+        {
+            auto& state = get_state();
+            uint16_t count = N - state.untouched;
+            for (auto block = state.free_list; block != nullptr; block = block->next)
+            {
+                count++;
+            }
+            return count;
+        }
+
+    private:
+        static const size_t OBJECT_SIZE{ sizeof(T) };
+        static const size_t SHARED_SIZE{ sizeof(PoolControlBlock<T, N>) };
+        static const size_t BLOCK_SIZE{ OBJECT_SIZE > SHARED_SIZE ? OBJECT_SIZE : SHARED_SIZE };
+
+        union Block
+        {
+            Block* next;
+            alignas(T) alignas(PoolControlBlock<T, N>) uint8_t data[BLOCK_SIZE];
+        };
+
+        // Zero initialized, no construction needed.
+        struct State
+        {
+            Block blocks[N];
+            Block* free_list;
+            uint16_t untouched;
+        };
+
+        static State& get_state(void)
+        {
+            static State state;
+            return state;
+        }
+    };
+
+    /**
+     * Deletion policy for objects allocated within a Pool. Destroys
+     * the object and gives its block back to the Pool.
+     * @param U type of the allocated object.
+     * @param N number of blocks of the Pool.
+     */
+    template<typename U, uint16_t N>
+    struct PoolDelete
+    {
+        /**
+         * Destroys the provided object and recycles its block.
+         * @param T U or a base type of U.
+         * @param data can be nullptr.
+         */
+        template<typename T>
+        void operator ()(T* data) const
+        {
+            if (data != nullptr)
+            {
+                auto object = static_cast<U*>(data);
+                untrack(object);
+                object->~U();
+                Pool<U, N>::release(object);
+            }
+        }
+    };
+
+    /**
+     * ControlBlock holding a shared object and its reference count
+     * within a single Pool block.
+     * @param T type of the shared object.
+     * @param N number of blocks of the Pool.
+     */
+    template<typename T, uint16_t N>
+    class PoolControlBlock : public ControlBlock
+    {
+    public:
+        /**
+         * Initializes this PoolControlBlock and its object with the
+         * provided parameters.
+         * @param args must match one of T's constructors.
+         */
+        template<class... Args>
+        PoolControlBlock(Args&&... args) : _data{ Memory::forward<Args>(args)... }
+        {
+            // Empty body.
+        }
+
+        virtual ~PoolControlBlock(void) = default;
+
+        /**
+         * @return the address of the managed object.
+         */
+        T* get(void) { return &_data; }
+
+        /**
+         * Destroys the managed object and gives the block back to the Pool.
+         */
+        void release(void) override
+        {
+            untrack(this);
+            this->~PoolControlBlock();
+            Pool<T, N>::release(this);
+        }
+
+    private:
+        T _data;
+    };
+}
\ No newline at end of file
@@ -0,0 +1,161 @@
+/*
+ * ----------------------------------------------------------------------------
+ * RefCount
+ * Reference counting policies for S_ptr and I_ptr.
+ * Part of the ArduinoLibraries project, to be used with any Arduino board.
+ * <https://github.com/Pierrolefou881/ArduinoLibraries>
+ * ----------------------------------------------------------------------------
+ *
+ * Copyright (C) 2025  Pierre DEBAS
+ * <dpierre394@gmail.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#pragma once
+#include <stdint.h>
+
+#if defined(__AVR__)
+#include <avr/io.h>
+#include <avr/interrupt.h>
+#endif
+
+// One of NonAtomicCount, AtomicCount or InterruptSafeCount.
+#ifndef MEMORY_REF_COUNT
+#define MEMORY_REF_COUNT NonAtomicCount
+#endif
+
+/*
+ * A counting policy is a type wrapping a reference count, with:
+ * - a constructor taking the initial count,
+ * - uint16_t load(void) const,
+ * - void increase(void),
+ * - bool decrease(void): returns true once the count dropped to 0.
+ * The policy used by every ControlBlock and RefCounted is RefCount, chosen
+ * at compile time by defining MEMORY_REF_COUNT before including Memory.hpp,
+ * e.g. -DMEMORY_REF_COUNT=AtomicCount (NonAtomicCount by default). The choice must be the same in every
+ * translation unit of the program.
+ */
+namespace Memory
+{
+    /**
+     * Plain counter. Cheapest policy, for single threaded programs that
+     * never share pointers with interrupt service routines.
+     */
+    class NonAtomicCount
+    {
+    public:
+        NonAtomicCount(uint16_t initial) : _count{ initial }
+        {
+            // Empty body.
+        }
+
+        uint16_t load(void) const { return _count; }
+
+        void increase(void) { _count++; }
+
+        bool decrease(void) { return --_count == 0; }
+
+    private:
+        uint16_t _count{ };
+    };
+
+    /**
+     * Counter masking interrupts while it is updated, so that pointers
+     * can be copied and released within interrupt service routines.
+     * Relies on atomic instructions on cores that provide them.
+     */
+    class InterruptSafeCount
+    {
+    public:
+        InterruptSafeCount(uint16_t initial) : _count{ initial }
+        {
+            // Empty body.
+        }
+
+#if defined(__AVR__)
+        // 16-bit accesses take two instructions on AVR.
+        uint16_t load(void) const
+        {
+            auto status = SREG;
+            cli();
+            auto count = _count;
+            SREG = status;
+            return count;
+        }
+
+        void increase(void)
+        {
+            auto status = SREG;
+            cli();
+            _count++;
+            SREG = status;
+        }
+
+        bool decrease(void)
+        {
+            auto status = SREG;
+            cli();
+            auto released = --_count == 0;
+            SREG = status;
+            return released;
+        }
+#else
+        uint16_t load(void) const { return __atomic_load_n(&_count, __ATOMIC_RELAXED); }
+
+        void increase(void) { __atomic_fetch_add(&_count, 1, __ATOMIC_RELAXED); }
+
+        bool decrease(void) { return __atomic_sub_fetch(&_count, 1, __ATOMIC_ACQ_REL) == 0; }
+#endif
+
+    private:
+        uint16_t _count{ };
+    };
+
+#if defined(__AVR__)
+    /**
+     * AVR boards are single cored: being safe against interrupts
+     * is being atomic.
+     */
+    typedef InterruptSafeCount AtomicCount;
+#else
+    /**
+     * Counter updated with atomic instructions, for pointers shared
+     * between threads. Increments are relaxed: a new reference can only
+     * be made from an existing one. Decrements are acquire-release, so
+     * that the last owner sees every write before destroying the object.
+     */
+    class AtomicCount
+    {
+    public:
+        AtomicCount(uint16_t initial) : _count{ initial }
+        {
+            // Empty body.
+        }
+
+        uint16_t load(void) const { return __atomic_load_n(&_count, __ATOMIC_RELAXED); }
+
+        void increase(void) { __atomic_fetch_add(&_count, 1, __ATOMIC_RELAXED); }
+
+        bool decrease(void) { return __atomic_sub_fetch(&_count, 1, __ATOMIC_ACQ_REL) == 0; }
+
+    private:
+        uint16_t _count{ };
+    };
+#endif
+
+    /**
+     * Counting policy of S_ptr and I_ptr, see MEMORY_REF_COUNT.
+     */
+    typedef MEMORY_REF_COUNT RefCount;
+}
\ No newline at end of file
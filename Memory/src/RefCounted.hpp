@@ -0,0 +1,78 @@
+/*
+ * ----------------------------------------------------------------------------
+ * RefCounted
+ * Base class for objects holding their own reference count.
+ * Part of the ArduinoLibraries project, to be used with any Arduino board.
+ * <https://github.com/Pierrolefou881/ArduinoLibraries>
+ * ----------------------------------------------------------------------------
+ *
+ * Copyright (C) 2025  Pierre DEBAS
+ * <dpierre394@gmail.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#pragma once
+#include "RefCount.hpp"
+#include <stdint.h>
+
+namespace Memory
+{
+    /**
+     * Base class for objects that keep their own reference count,
+     * so that they can be shared through I_ptr instances. Unlike S_ptr,
+     * no ControlBlock is needed: sharing costs nothing beyond the
+     * count stored within the object, updated according to the
+     * RefCount policy.
+     * CAUTION: objects deleted through a pointer to a base class must
+     *          declare a virtual destructor in said base class.
+     */
+    class RefCounted
+    {
+    public:
+        /**
+         * @return the number of I_ptr instances referencing this RefCounted.
+         */
+        uint16_t ref_count(void) const { return _ref_count.load(); }
+
+        template<typename T, typename D>
+        friend class I_ptr;
+
+    protected:
+        /**
+         * Initializes this RefCounted with no reference.
+         */
+        RefCounted(void) : _ref_count{ 0 }
+        {
+            // Empty body.
+        }
+
+        // Copies are new objects, they don't inherit any reference.
+        RefCounted(const RefCounted&) : _ref_count{ 0 }
+        {
+            // Empty body.
+        }
+
+        RefCounted& operator =(const RefCounted&) { return *this; }
+
+        // Not meant to be deleted through a RefCounted pointer.
+        ~RefCounted(void) = default;
+
+    private:
+        RefCount _ref_count;
+
+        void increase_ref_count(void) { _ref_count.increase(); }
+
+        bool decrease_ref_count(void) { return _ref_count.decrease(); }
+    };
+}
\ No newline at end of file
@@ -0,0 +1,115 @@
+/*
+ * ----------------------------------------------------------------------------
+ * Relocate
+ * Moves elements within and between arrays, bytewise when possible.
+ * Part of the ArduinoLibraries project, to be used with any Arduino board.
+ * <https://github.com/Pierrolefou881/ArduinoLibraries>
+ * ----------------------------------------------------------------------------
+ *
+ * Copyright (C) 2025  Pierre DEBAS
+ * <dpierre394@gmail.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#pragma once
+#include "Utility.hpp"
+#include <stdint.h>
+#include <string.h>
+
+// Each operation comes in two overloads, chosen at compile time: a single
+// memmove or memcpy for trivially copyable T, moves and destructor calls
+// one element at a time otherwise.
+namespace Memory
+{
+    /**
+     * Moves count elements to uninitialized memory, then destroys them
+     * at their former address.
+     * @param destination uninitialized memory for count elements. Must
+     *        not overlap source.
+     * @param source first of count constructed elements.
+     * @param count number of elements.
+     */
+    template<typename T>
+    typename EnableIf<IsTriviallyCopyable<T>::value>::type
+    relocate(T* destination, T* source, uint16_t count)
+    {
+        if (count > 0)
+        {
+            memcpy(destination, source, sizeof(T) * count);
+        }
+    }
+
+    template<typename T>
+    typename EnableIf<!IsTriviallyCopyable<T>::value>::type
+    relocate(T* destination, T* source, uint16_t count)
+    {
+        for (uint16_t index = 0; index < count; index++)
+        {
+            new (destination + index) T{ Memory::move(source[index]) };
+            source[index].~T();
+        }
+    }
+
+    /**
+     * Moves the elements from index to size one step forward, leaving
+     * data[index] destroyed, ready for a new element.
+     * @param data array of size constructed elements, with room for one more.
+     * @param index of the gap to open. Must be strictly inferior to size.
+     * @param size number of constructed elements.
+     */
+    template<typename T>
+    typename EnableIf<IsTriviallyCopyable<T>::value>::type
+    shift_forward(T* data, uint16_t index, uint16_t size)
+    {
+        memmove(data + index + 1, data + index, sizeof(T) * (size - index));
+    }
+
+    template<typename T>
+    typename EnableIf<!IsTriviallyCopyable<T>::value>::type
+    shift_forward(T* data, uint16_t index, uint16_t size)
+    {
+        new (data + size) T{ Memory::move(data[size - 1]) };
+        for (auto current = size - 1; current > index; current--)
+        {
+            data[current] = Memory::move(data[current - 1]);
+        }
+        data[index].~T();
+    }
+
+    /**
+     * Moves the elements following index one step backward over
+     * data[index], then destroys the last one.
+     * @param data array of size constructed elements.
+     * @param index of the element to overwrite. Must be strictly
+     *        inferior to size.
+     * @param size number of constructed elements.
+     */
+    template<typename T>
+    typename EnableIf<IsTriviallyCopyable<T>::value>::type
+    shift_backward(T* data, uint16_t index, uint16_t size)
+    {
+        memmove(data + index, data + index + 1, sizeof(T) * (size - index - 1));
+    }
+
+    template<typename T>
+    typename EnableIf<!IsTriviallyCopyable<T>::value>::type
+    shift_backward(T* data, uint16_t index, uint16_t size)
+    {
+        for (auto current = index; current + 1 < size; current++)
+        {
+            data[current] = Memory::move(data[current + 1]);
+        }
+        data[size - 1].~T();
+    }
+}
\ No newline at end of file
@@ -24,6 +24,11 @@
  */
 #pragma once
 #include "SmartPointer.hpp"
+#include "ControlBlock.hpp"
+#include "Utility.hpp"
+#include "Pool.hpp"
+#include "Arena.hpp"
+#include "Allocator.hpp"
 #include <stdint.h>
 
 namespace Memory
@@ -32,6 +37,8 @@ namespace Memory
      * Pointer wrapper that automatically deallocates memory when
      * reference count to the pointed object drops to 0. This means
      * that several client objects can point to the same data.
+     * The reference count lives in a ControlBlock, allocated only
+     * when there is data to share. A nullptr S_ptr allocates nothing.
      * @param T can be any type.
      */
     template<typename T>
@@ -45,34 +52,60 @@ namespace Memory
 
         /**
             * Initializes this S_ptr with the provided pointer to data. If data not null,
-            * increases the reference count to 1.
+            * allocates a ControlBlock with a reference count of 1.
+            * Prefer make_shared, which allocates data and count at once.
             * @param data pointer. Can be nullptr.
             */
-        S_ptr(T* data) : SmartPointer<T>{ data }, _ref_count{ new uint16_t{ 0 } }
+        S_ptr(T* data) 
+            : SmartPointer<T>{ data }
+            , _block{ data != nullptr ? track(new PointerControlBlock<T>{ track(data) }) : nullptr }
         {
-            if (data != nullptr)
-            {
-                (*_ref_count)++;
-            }
+            // Empty body.
         }
 
-        S_ptr(const S_ptr<T>& other) : SmartPointer<T>{ other.get() }, _ref_count{ other._ref_count }
+        /**
+            * Initializes this S_ptr with the provided pointer to data, to be released
+            * with the provided deletion policy, e.g. to give it back to a static
+            * buffer. If data not null, allocates a ControlBlock holding the deleter.
+            * S_ptr itself stays the same size whatever the deleter.
+            * @param D deletion policy, callable with a T*.
+            * @param data pointer. Can be nullptr.
+            * @param deleter called upon data when the last S_ptr releases it.
+            */
+        template<typename D, typename = typename EnableIf<!IsConvertible<D, ControlBlock*>::value>::type>
+        S_ptr(T* data, D deleter) 
+            : SmartPointer<T>{ data }
+            , _block{ data != nullptr ? track(new PointerControlBlock<T, D>{ track(data), deleter }) : nullptr }
         {
-            if (other.get() != nullptr)
-            {
-                (*_ref_count)++;
-            }
+            // Empty body.
+        }
+
+        /**
+            * Initializes this S_ptr with an already counted ControlBlock. Used by
+            * make_shared, which creates the object and its block together.
+            * @param data pointer to the object managed by block. Can be nullptr.
+            * @param block holding one reference to data. Can be nullptr.
+            */
+        S_ptr(T* data, ControlBlock* block) : SmartPointer<T>{ data }, _block{ block }
+        {
+            // Empty body.
         }
 
-        S_ptr(S_ptr&& other) noexcept : SmartPointer<T>{ other.get() }, _ref_count{ other._ref_count }
+        S_ptr(const S_ptr<T>& other) : SmartPointer<T>{ other.get() }, _block{ other._block }
         {
-            if (other.get() != nullptr)
+            if (_block != nullptr)
             {
-                (*_ref_count)++;
+                _block->increase();
             }
         }
 
-        virtual ~S_ptr(void)
+        S_ptr(S_ptr&& other) noexcept : SmartPointer<T>{ other.get() }, _block{ other._block }
+        {
+            other.SmartPointer<T>::set_data(nullptr);
+            other._block = nullptr;
+        }
+
+        ~S_ptr(void)
         {
             decrease_ref_count();
         }
@@ -82,7 +115,7 @@ namespace Memory
          */
         uint16_t count(void) const
         {
-            return *_ref_count;
+            return _block == nullptr ? 0 : _block->count();
         }
 
         S_ptr<T>& operator =(T* data_ptr)
@@ -91,10 +124,9 @@ namespace Memory
             {
                 decrease_ref_count();
                 SmartPointer<T>::set_data(data_ptr);
-                _ref_count = new uint16_t{ };
                 if (data_ptr != nullptr)
                 {
-                    *_ref_count += 1;
+                    _block = track(new PointerControlBlock<T>{ track(data_ptr) });
                 }
             }
             return *this;
@@ -102,14 +134,14 @@ namespace Memory
 
         S_ptr<T>& operator =(const S_ptr<T>& other)
         {
-            if (other != *this)
+            if (other._block != _block)
             {
                 decrease_ref_count();
                 SmartPointer<T>::set_data(other.get());
-                _ref_count = other._ref_count;
-                if (other != nullptr)
+                _block = other._block;
+                if (_block != nullptr)
                 {
-                    *_ref_count += 1;
+                    _block->increase();
                 }
             }
             return *this;
@@ -117,47 +149,66 @@ namespace Memory
 
         S_ptr<T>& operator =(S_ptr<T>&& other) noexcept
         {
-            if (other != *this)
+            if (other._block != _block)
             {
                 decrease_ref_count();
                 SmartPointer<T>::set_data(other.get());
-                _ref_count = other._ref_count;
-                if (other != nullptr)
-                {
-                    *_ref_count += 1;
-                }
+                _block = other._block;
+                other.SmartPointer<T>::set_data(nullptr);
+                other._block = nullptr;
             }
             return *this;
         }
 
     private:
-        uint16_t* _ref_count{ new uint16_t{ 0 }};
+        ControlBlock* _block{ };
 
         void decrease_ref_count(void)
         {
-            if (*this == nullptr)
+            if (_block == nullptr)
             {
                 return;
             }
 
-            *_ref_count -= 1;
-            if (*_ref_count == 0)
+            // Detach before releasing, the destroyed object may
+            // still reach this S_ptr.
+            auto block = _block;
+            _block = nullptr;
+            SmartPointer<T>::set_data(nullptr);
+            if (block->decrease())
             {
-                delete _ref_count;
-                auto tmp = SmartPointer<T>::get();
-                SmartPointer<T>::set_data(nullptr);
-                delete tmp;
+                block->release();
             }
         }
     };
 
+    // Locks the size in: the shared object and its ControlBlock, nothing more.
+    static_assert(sizeof(S_ptr<uint8_t>) == 2 * sizeof(void*), "S_ptr must be two pointers wide");
+
+    /**
+     * Allocates an instance of U along with its reference count in
+     * a single InlineControlBlock and wraps it in a S_ptr<T>.
+     * Backend for all make_shared overloads.
+     * @param T can be any type.
+     * @param U is T or a derived type of T.
+     * @param Args types of arguments.
+     * @param args must match one of U's constructors.
+     * @return a new S_ptr<T> wrapping the newly instanced U.
+     */
+    template<typename T, typename U, class... Args>
+    S_ptr<T> make_shared_inline(Args&&... args)
+    {
+        auto block = track(new InlineControlBlock<U>{ Memory::forward<Args>(args)... });
+        return { static_cast<T*>(block->get()), block };
+    }
+
     /**
      * @return a S_ptr pointing to a default instance of T.
      */
     template<typename T>
     S_ptr<T> make_shared(void)
     {
-        return { new T{ } };
+        return make_shared_inline<T, T>();
     }
 
     /**
@@ -167,9 +218,9 @@ namespace Memory
      * @return a S_ptr instance pointing to the newly created instance of T.
      */
     template<typename T, class... Args>
-    S_ptr<T> make_shared(Args&&... args)
+    typename EnableIf<!IsAllocatorTag<Args...>::value, S_ptr<T>>::type make_shared(Args&&... args)
     {
-        return { new T{ args... } };
+        return make_shared_inline<T, T>(Memory::forward<Args>(args)...);
     }
 
     /**
@@ -182,7 +233,7 @@ namespace Memory
     template<typename T, typename U>
     S_ptr<T> make_shared(void)
     {
-        return { new U{ } };
+        return make_shared_inline<T, U>();
     }
 
     /**
@@ -195,8 +246,103 @@ namespace Memory
      * @return a new S_ptr<T> wrapping the newly instanced U.
      */
     template<typename T, typename U, class... Args>
-    S_ptr<T> make_shared(Args&&... args)
+    typename EnableIf<!IsAllocatorTag<Args...>::value, S_ptr<T>>::type make_shared(Args&&... args)
+    {
+        return make_shared_inline<T, U>(Memory::forward<Args>(args)...);
+    }
+
+    /**
+     * Creates a new instance of S_ptr<T> holding an instance of U allocated,
+     * along with its reference count, within a single block of the provided
+     * Pool. The block goes back to the Pool when the last S_ptr releases it.
+     * @param T can be any type.
+     * @param U is T or a derived type of T. Deduced from the Pool.
+     * @param N number of blocks of the Pool.
+     * @param Args types of arguments.
+     * @param pool tag selecting the Pool to allocate from.
+     * @param args must match one of U's constructors.
+     * @return a new S_ptr<T> wrapping the newly instanced U, or nullptr
+     *         if the Pool is exhausted.
+     */
+    template<typename T, typename U, uint16_t N, class... Args>
+    S_ptr<T> make_shared(const Pool<U, N>& pool, Args&&... args)
+    {
+        auto memory = pool.allocate();
+        if (memory == nullptr)
+        {
+            return { };
+        }
+        auto block = track(new (memory) PoolControlBlock<U, N>{ Memory::forward<Args>(args)... });
+        return { static_cast<T*>(block->get()), block };
+    }
+
+    /**
+     * Creates a new instance of S_ptr<T> holding an instance of U allocated,
+     * along with its reference count, within the provided Arena. The object
+     * gets destroyed with its last S_ptr, but its memory is freed only along
+     * with the whole Arena.
+     * @param T can be any type.
+     * @param U is T or a derived type of T. T by default.
+     * @param Args types of arguments.
+     * @param arena to allocate from.
+     * @param args must match one of U's constructors.
+     * @return a new S_ptr<T> wrapping the newly instanced U, or nullptr
+     *         if the Arena is full.
+     */
+    template<typename T, typename U = T, class... Args>
+    S_ptr<T> make_shared(Arena& arena, Args&&... args)
+    {
+        typedef InlineControlBlock<U, ArenaDelete> Block;
+        auto memory = arena.allocate(sizeof(Block), alignof(Block));
+        if (memory == nullptr)
+        {
+            return { };
+        }
+        auto block = track(new (memory) Block{ Memory::forward<Args>(args)... });
+        return { static_cast<T*>(block->get()), block };
+    }
+
+    /**
+     * Creates a new instance of S_ptr<T> holding an instance of U created,
+     * along with its reference count, in a single allocation made by the
+     * allocation policy A. The memory goes back to A when the last S_ptr
+     * releases the object. Unlike make_shared, A is never mistaken for an
+     * argument of U's constructor, whatever its type (e.g. a Pool).
+     * @param T can be any type.
+     * @param A allocation policy.
+     * @param U is T or a derived type of T. T by default.
+     * @param Args types of arguments.
+     * @param args must match one of U's constructors.
+     * @return a new S_ptr<T> wrapping the newly instanced U, or nullptr
+     *         if A ran out of memory.
+     */
+    template<typename T, typename A, typename U = T, class... Args>
+    S_ptr<T> allocate_shared(Args&&... args)
+    {
+        auto block = create<AllocatorControlBlock<U, A>, A>(Memory::forward<Args>(args)...);
+        if (block == nullptr)
+        {
+            return { };
+        }
+        return { static_cast<T*>(block->get()), block };
+    }
+
+    /**
+     * Creates a new instance of S_ptr<T> holding an instance of U created,
+     * along with its reference count, in a single allocation made by the
+     * provided allocation policy. The memory goes back to the allocation
+     * policy when the last S_ptr releases the object.
+     * @param T can be any type.
+     * @param U is T or a derived type of T. T by default.
+     * @param A allocation policy.
+     * @param Args types of arguments.
+     * @param args must match one of U's constructors.
+     * @return a new S_ptr<T> wrapping the newly instanced U, or nullptr
+     *         if the allocation policy ran out of memory.
+     */
+    template<typename T, typename U = T, typename A, class... Args>
+    typename EnableIf<IsAllocatorTag<A>::value, S_ptr<T>>::type make_shared(const A&, Args&&... args)
     {
-        return { new U{ args... } };
+        return allocate_shared<T, A, U>(Memory::forward<Args>(args)...);
     }
 }
\ No newline at end of file
@@ -0,0 +1,190 @@
+/*
+ * ----------------------------------------------------------------------------
+ * SmallArray
+ * Array keeping its first elements inline, spilling to an allocation policy.
+ * Part of the ArduinoLibraries project, to be used with any Arduino board.
+ * <https://github.com/Pierrolefou881/ArduinoLibraries>
+ * ----------------------------------------------------------------------------
+ *
+ * Copyright (C) 2025  Pierre DEBAS
+ * <dpierre394@gmail.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#pragma once
+#include "StaticArray.hpp"
+#include "U_array.hpp"
+#include "Allocator.hpp"
+#include "Utility.hpp"
+#include <stdint.h>
+
+namespace Memory
+{
+    /**
+     * Array storing up to N elements of T within the object itself, and
+     * spilling to a buffer given by the allocation policy A beyond that.
+     * Elements move back inline when the capacity shrinks to N or less.
+     * Offers the same operations as U_array, but can't be moved.
+     * CAUTION: arguments of emplace() must not refer to elements of the
+     *          SmallArray they are inserted into.
+     * @param T can be any type.
+     * @param N inline capacity, strictly positive.
+     * @param A allocation policy beyond N elements. HeapAllocator by default.
+     */
+    template<typename T, uint16_t N, typename A = HeapAllocator>
+    class SmallArray
+    {
+    public:
+        SmallArray(void) = default;
+        SmallArray(const SmallArray&) = delete;
+        SmallArray& operator =(const SmallArray&) = delete;
+
+        /**
+         * @return true if the elements live in the buffer given by A,
+         *         false if they are stored inline.
+         */
+        bool is_spilled(void) const { return _heap.capacity() > 0; }
+
+        /**
+         * @return the address of the first element.
+         */
+        T* get(void) const { return is_spilled() ? _heap.get() : _inline.get(); }
+
+        /**
+         * @return the number of constructed elements.
+         */
+        uint16_t size(void) const { return is_spilled() ? _heap.size() : _inline.size(); }
+
+        /**
+         * @return the number of elements this SmallArray can hold, never
+         *         less than N.
+         */
+        uint16_t capacity(void) const { return is_spilled() ? _heap.capacity() : N; }
+
+        /**
+         * Accesses the element at the given index.
+         * CAUTION: index must be strictly inferior to size().
+         * @param index of the element.
+         * @return the reference to the element.
+         */
+        T& operator [](uint16_t index) const { return get()[index]; }
+
+        /**
+         * Changes the capacity. Up to N, elements are stored inline and
+         * capacity() stays N. Beyond N, they are moved to a buffer of
+         * new_capacity elements given by A.
+         * @param new_capacity can't be inferior to size().
+         * @return true if new_capacity elements fit, false if A ran out of
+         *         memory or new_capacity is too small, in which case this
+         *         SmallArray is left untouched.
+         */
+        bool reallocate(uint16_t new_capacity)
+        {
+            if (new_capacity < size())
+            {
+                return false;
+            }
+            if (new_capacity > N)
+            {
+                if (is_spilled())
+                {
+                    return _heap.reallocate(new_capacity);
+                }
+                if (!_heap.reallocate(new_capacity))
+                {
+                    return false;
+                }
+                for (uint16_t index = 0; index < _inline.size(); index++)
+                {
+                    _heap.emplace(index, Memory::move(_inline[index]));
+                }
+                _inline.clear();
+                return true;
+            }
+            if (is_spilled())
+            {
+                for (uint16_t index = 0; index < _heap.size(); index++)
+                {
+                    _inline.emplace(index, Memory::move(_heap[index]));
+                }
+                _heap.clear();
+                _heap.reallocate(0);
+            }
+            return true;
+        }
+
+        /**
+         * Constructs an element in place at the given index. Following
+         * elements are moved one step forward.
+         * @param index of insertion. Can't be superior to size().
+         * @param args must match one of T's constructors.
+         * @return true if insertion successful, false if index is out of
+         *         bounds or the array is full.
+         */
+        template<class... Args>
+        bool emplace(uint16_t index, Args&&... args)
+        {
+            return is_spilled() 
+                    ? _heap.emplace(index, Memory::forward<Args>(args)...)
+                    : _inline.emplace(index, Memory::forward<Args>(args)...);
+        }
+
+        /**
+         * Destroys the element at the given index. Following elements
+         * are moved one step backward. Does nothing if index is out
+         * of bounds.
+         * @param index of the element to remove.
+         */
+        void erase(uint16_t index)
+        {
+            if (is_spilled())
+            {
+                _heap.erase(index);
+            }
+            else
+            {
+                _inline.erase(index);
+            }
+        }
+
+        /**
+         * Destroys all elements. The capacity is left unchanged.
+         */
+        void clear(void)
+        {
+            _heap.clear();
+            _inline.clear();
+        }
+
+    private:
+        StaticArray<T, N> _inline{ };
+        U_array<T, A> _heap{ };
+    };
+
+    /**
+     * Storage policy selecting a SmallArray: the first N elements are
+     * stored inline, the following ones in a buffer given by A, e.g.
+     * Collection::ArrayList<int, SmallStorage<8>>.
+     * @param N inline capacity, strictly positive.
+     * @param A allocation policy beyond N elements. HeapAllocator by default.
+     */
+    template<uint16_t N, typename A = HeapAllocator>
+    struct SmallStorage { };
+
+    template<typename T, uint16_t N, typename A>
+    struct ArrayStorage<T, SmallStorage<N, A>>
+    {
+        typedef SmallArray<T, N, A> type;
+    };
+}
\ No newline at end of file
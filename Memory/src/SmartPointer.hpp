@@ -29,16 +29,14 @@ namespace Memory
     /**
      * Base behavior for all smart pointers for Arduino. Smart pointers
      * manage memory deallocation automatically and greatly reduce risks
-     * of memory leaks.
+     * of memory leaks. SmartPointer has no virtual member, so that
+     * smart pointers are no wider than the pointers they wrap.
      * @param T can be any type.
      */
     template<typename T>
     class SmartPointer
     {
     public:
-        // Don't manage deallocation here, derived types shall do it.
-        virtual ~SmartPointer(void) = default;
-
         /**
          * @return _data member as a non mutable pointer.
          */
@@ -106,6 +104,10 @@ namespace Memory
             // Empty body
         }
 
+        // Don't manage deallocation here, derived types shall do it.
+        // Not meant to be deleted through a SmartPointer pointer.
+        ~SmartPointer(void) = default;
+
         /**
          * Changes the value of the _data member.
          * @param new_data to assign. Can be nullptr.
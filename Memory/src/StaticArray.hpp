@@ -0,0 +1,175 @@
+/*
+ * ----------------------------------------------------------------------------
+ * StaticArray
+ * Fixed capacity array stored inline, e.g. heap free collections storage.
+ * Part of the ArduinoLibraries project, to be used with any Arduino board.
+ * <https://github.com/Pierrolefou881/ArduinoLibraries>
+ * ----------------------------------------------------------------------------
+ *
+ * Copyright (C) 2025  Pierre DEBAS
+ * <dpierre394@gmail.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#pragma once
+#include "U_array.hpp"
+#include "Relocate.hpp"
+#include "Utility.hpp"
+#include <stdint.h>
+
+namespace Memory
+{
+    /**
+     * Array of at most N elements of T, stored within the object itself:
+     * no allocation ever occurs. Offers the same operations as U_array,
+     * only the first size() elements being constructed.
+     * CAUTION: arguments of emplace() must not refer to elements of the
+     *          StaticArray they are inserted into.
+     * @param T can be any type.
+     * @param N capacity, strictly positive.
+     */
+    template<typename T, uint16_t N>
+    class StaticArray
+    {
+    public:
+        StaticArray(void) = default;
+        StaticArray(const StaticArray&) = delete;
+        StaticArray& operator =(const StaticArray&) = delete;
+
+        ~StaticArray(void)
+        {
+            clear();
+        }
+
+        /**
+         * @return the address of the first element.
+         */
+        T* get(void) const { return (T*) _storage; }
+
+        /**
+         * @return the number of constructed elements.
+         */
+        uint16_t size(void) const { return _size; }
+
+        /**
+         * @return N.
+         */
+        uint16_t capacity(void) const { return N; }
+
+        /**
+         * Accesses the element at the given index.
+         * CAUTION: index must be strictly inferior to size().
+         * @param index of the element.
+         * @return the reference to the element.
+         */
+        T& operator [](uint16_t index) const { return get()[index]; }
+
+        /**
+         * Capacity is fixed, so nothing is reallocated.
+         * @param new_capacity requested capacity.
+         * @return true if new_capacity elements fit, i.e. if new_capacity is
+         *         within size() and N, false otherwise.
+         */
+        bool reallocate(uint16_t new_capacity) const
+        {
+            return new_capacity >= _size && new_capacity <= N;
+        }
+
+        /**
+         * Constructs an element in place at the given index. Following
+         * elements are moved one step forward.
+         * @param index of insertion. Can't be superior to size().
+         * @param args must match one of T's constructors.
+         * @return true if insertion successful, false if index is out of
+         *         bounds or the array is full.
+         */
+        template<class... Args>
+        bool emplace(uint16_t index, Args&&... args)
+        {
+            if (index > _size || _size == N)
+            {
+                return false;
+            }
+
+            auto data = get();
+            if (index < _size)
+            {
+                Memory::shift_forward(data, index, _size);
+            }
+            new (data + index) T{ Memory::forward<Args>(args)... };
+            _size++;
+            return true;
+        }
+
+        /**
+         * Destroys the element at the given index. Following elements
+         * are moved one step backward. Does nothing if index is out
+         * of bounds.
+         * @param index of the element to remove.
+         */
+        void erase(uint16_t index)
+        {
+            if (index >= _size)
+            {
+                return;
+            }
+
+            auto data = get();
+            Memory::shift_backward(data, index, _size);
+            _size--;
+        }
+
+        /**
+         * Destroys all elements.
+         */
+        void clear(void)
+        {
+            auto data = get();
+            while (_size > 0)
+            {
+                _size--;
+                data[_size].~T();
+            }
+        }
+
+    private:
+        alignas(T) uint8_t _storage[sizeof(T) * N];
+        uint16_t _size{ };
+    };
+
+    /**
+     * Storage policy selecting a StaticArray of N elements instead of an
+     * allocation policy, e.g. Collection::ArrayList<int, InlineStorage<8>>.
+     * @param N capacity, strictly positive.
+     */
+    template<uint16_t N>
+    struct InlineStorage { };
+
+    /**
+     * Exposes as type the array storing elements of T according to the
+     * storage policy S: a U_array using S as allocation policy, unless S
+     * is a storage policy such as InlineStorage.
+     */
+    template<typename T, typename S>
+    struct ArrayStorage
+    {
+        typedef U_array<T, S> type;
+    };
+
+    template<typename T, uint16_t N>
+    struct ArrayStorage<T, InlineStorage<N>>
+    {
+        typedef StaticArray<T, N> type;
+    };
+}
\ No newline at end of file
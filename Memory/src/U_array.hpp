@@ -0,0 +1,227 @@
+/*
+ * ----------------------------------------------------------------------------
+ * U_array
+ * Owner of a dynamically sized array, e.g. collections storage.
+ * Part of the ArduinoLibraries project, to be used with any Arduino board.
+ * <https://github.com/Pierrolefou881/ArduinoLibraries>
+ * ----------------------------------------------------------------------------
+ *
+ * Copyright (C) 2025  Pierre DEBAS
+ * <dpierre394@gmail.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#pragma once
+#include "Allocator.hpp"
+#include "Instrumentation.hpp"
+#include "Relocate.hpp"
+#include "Utility.hpp"
+#include <stdint.h>
+
+namespace Memory
+{
+    /**
+     * Owns a buffer of capacity() elements of T given by the allocation
+     * policy A. Only the first size() elements are constructed, so that
+     * spare capacity holds no object, e.g. no S_ptr keeping a reference.
+     * Elements are destroyed, and the buffer given back to A, when this
+     * U_array is destroyed. A U_array can be moved but not copied.
+     * CAUTION: arguments of emplace() must not refer to elements of the
+     *          U_array they are inserted into.
+     * @param T can be any type.
+     * @param A allocation policy. HeapAllocator by default.
+     */
+    template<typename T, typename A = HeapAllocator>
+    class U_array
+    {
+    public:
+        /**
+         * Initializes this U_array without any buffer.
+         */
+        U_array(void) = default;
+
+        U_array(const U_array&) = delete;
+
+        U_array(U_array&& other) noexcept 
+            : _data{ other._data }
+            , _size{ other._size }
+            , _capacity{ other._capacity }
+        {
+            other._data = nullptr;
+            other._size = 0;
+            other._capacity = 0;
+        }
+
+        ~U_array(void)
+        {
+            clear();
+            release_buffer();
+        }
+
+        U_array& operator =(const U_array&) = delete;
+
+        U_array& operator =(U_array&& other) noexcept
+        {
+            if (&other != this)
+            {
+                clear();
+                release_buffer();
+                _data = other._data;
+                _size = other._size;
+                _capacity = other._capacity;
+                other._data = nullptr;
+                other._size = 0;
+                other._capacity = 0;
+            }
+            return *this;
+        }
+
+        /**
+         * @return the address of the first element, nullptr if there is
+         *         no buffer.
+         */
+        T* get(void) const { return _data; }
+
+        /**
+         * @return the number of constructed elements.
+         */
+        uint16_t size(void) const { return _size; }
+
+        /**
+         * @return the number of elements the buffer can hold.
+         */
+        uint16_t capacity(void) const { return _capacity; }
+
+        /**
+         * Accesses the element at the given index.
+         * CAUTION: index must be strictly inferior to size().
+         * @param index of the element.
+         * @return the reference to the element.
+         */
+        T& operator [](uint16_t index) const { return _data[index]; }
+
+        /**
+         * Changes the capacity of the buffer. Grows or shrinks in place if A
+         * allows it, moves the size() elements to a new buffer otherwise.
+         * @param new_capacity can't be inferior to size(). 0 frees the buffer.
+         * @return true if capacity() is now new_capacity, false if A ran
+         *         out of memory or new_capacity is too small, in which case
+         *         this U_array is left untouched.
+         */
+        bool reallocate(uint16_t new_capacity)
+        {
+            if (new_capacity < _size)
+            {
+                return false;
+            }
+            if (new_capacity == _capacity)
+            {
+                return true;
+            }
+            if (new_capacity == 0)
+            {
+                release_buffer();
+                return true;
+            }
+            if (_data != nullptr && A::reallocate(_data, sizeof(T) * new_capacity))
+            {
+                track_resize(_data, sizeof(T) * new_capacity);
+                _capacity = new_capacity;
+                return true;
+            }
+
+            auto data = static_cast<T*>(A::allocate(sizeof(T) * new_capacity, alignof(T)));
+            if (data == nullptr)
+            {
+                return false;
+            }
+            track(data, sizeof(T) * new_capacity);
+            Memory::relocate(data, _data, _size);
+            release_buffer();
+            _data = data;
+            _capacity = new_capacity;
+            return true;
+        }
+
+        /**
+         * Constructs an element in place at the given index. Following
+         * elements are moved one step forward.
+         * @param index of insertion. Can't be superior to size().
+         * @param args must match one of T's constructors.
+         * @return true if insertion successful, false if index is out of
+         *         bounds or the buffer is full.
+         */
+        template<class... Args>
+        bool emplace(uint16_t index, Args&&... args)
+        {
+            if (index > _size || _size == _capacity)
+            {
+                return false;
+            }
+
+            if (index < _size)
+            {
+                Memory::shift_forward(_data, index, _size);
+            }
+            new (_data + index) T{ Memory::forward<Args>(args)... };
+            _size++;
+            return true;
+        }
+
+        /**
+         * Destroys the element at the given index. Following elements
+         * are moved one step backward. Does nothing if index is out
+         * of bounds.
+         * @param index of the element to remove.
+         */
+        void erase(uint16_t index)
+        {
+            if (index >= _size)
+            {
+                return;
+            }
+
+            Memory::shift_backward(_data, index, _size);
+            _size--;
+        }
+
+        /**
+         * Destroys all elements. The capacity is left unchanged.
+         */
+        void clear(void)
+        {
+            while (_size > 0)
+            {
+                _size--;
+                _data[_size].~T();
+            }
+        }
+
+    private:
+        T* _data{ };
+        uint16_t _size{ };
+        uint16_t _capacity{ };
+
+        void release_buffer(void)
+        {
+            if (_data != nullptr)
+            {
+                untrack(_data);
+                A::deallocate(_data);
+            }
+            _data = nullptr;
+            _capacity = 0;
+        }
+    };
+}
\ No newline at end of file
@@ -24,6 +24,11 @@
  */
 #pragma once
 #include "SmartPointer.hpp"
+#include "Deleter.hpp"
+#include "Utility.hpp"
+#include "Pool.hpp"
+#include "Arena.hpp"
+#include "Allocator.hpp"
 
 namespace Memory
 {
@@ -33,9 +38,13 @@ namespace Memory
      * the _data member, i.e. the copied member becomes
      * nullptr while the copy holds exclusively the data.
      * @param T can be of any type.
+     * @param D deletion policy, called upon the wrapped data when
+     *          this U_ptr releases it. Stateless policies take no
+     *          room, so U_ptr stays as wide as SmartPointer<T>.
+     *          Uses delete by default.
      */
-    template<typename T>
-    class U_ptr : public SmartPointer<T>
+    template<typename T, typename D = DefaultDelete<T>>
+    class U_ptr : public SmartPointer<T>, private DeleterHolder<D>
     {
     public:
         /**
@@ -52,52 +61,96 @@ namespace Memory
             // Empty body.
         }
 
-        U_ptr(const U_ptr<T>& other) : SmartPointer<T>{ other.get() }
+        /**
+         * Initializes this U_ptr with the provided data pointer, to be
+         * released with the provided deletion policy.
+         * @param data can be nullptr.
+         * @param deleter called upon data when this U_ptr releases it.
+         */
+        U_ptr(T* data, const D& deleter) 
+            : SmartPointer<T>{ data }
+            , DeleterHolder<D>{ deleter }
+        {
+            // Empty body.
+        }
+
+        U_ptr(const U_ptr& other) 
+            : SmartPointer<T>{ other.get() }
+            , DeleterHolder<D>{ other.get_deleter() }
         {
-            ((U_ptr<T>&) other).set_data(nullptr);
+            ((U_ptr&) other).set_data(nullptr);
         }
 
-        U_ptr(U_ptr<T>&& other) noexcept : SmartPointer<T>{ other.get() }
+        U_ptr(U_ptr&& other) noexcept 
+            : SmartPointer<T>{ other.get() }
+            , DeleterHolder<D>{ other.get_deleter() }
         {
             other.set_data(nullptr);
         }
 
-        virtual ~U_ptr(void)
+        ~U_ptr(void)
         {
-            delete SmartPointer<T>::get();
+            dispose(SmartPointer<T>::get());
         }
 
-        U_ptr<T>& operator =(T* data_ptr)
+        U_ptr& operator =(T* data_ptr)
         {
             auto tmp = SmartPointer<T>::get();
             SmartPointer<T>::set_data(data_ptr);
-            delete tmp;
+            dispose(tmp);
             return *this;
         }
 
-        U_ptr<T>& operator =(const U_ptr<T>& other)
+        U_ptr& operator =(const U_ptr& other)
         {
             change_owner(other, *this);
             return *this;
         }
 
-        U_ptr<T>& operator =(U_ptr<T>&& other) noexcept
+        U_ptr& operator =(U_ptr&& other) noexcept
         {
             change_owner(other, *this);
             return *this;
         }
 
+        /**
+         * @return the deletion policy of this U_ptr.
+         */
+        using DeleterHolder<D>::get_deleter;
+
     private:
-        static void change_owner(const U_ptr<T>& source, const U_ptr<T>& destination)
+        static void change_owner(const U_ptr& source, const U_ptr& destination)
         {   
-            // Discard const qualifiers
-            auto del = ((U_ptr<T>&) destination).get();
-            ((U_ptr<T>&) destination).set_data(((U_ptr<T>&) source).get());
-            ((U_ptr<T>) source).set_data(nullptr);
-            delete del;
+            if (&source == &destination)
+            {
+                return;
+            }
+
+            // Discard const qualifiers; the former data goes with the former deleter.
+            auto& target = (U_ptr&) destination;
+            auto del = target.get();
+            D deleter{ target.get_deleter() };
+            target.set_data(((U_ptr&) source).get());
+            target.get_deleter() = source.get_deleter();
+            ((U_ptr&) source).set_data(nullptr);
+            if (del != nullptr)
+            {
+                deleter(del);
+            }
+        }
+
+        void dispose(T* data)
+        {
+            if (data != nullptr)
+            {
+                get_deleter()(data);
+            }
         }
     };
 
+    // Locks the size in: with a stateless deleter, a U_ptr is a raw pointer.
+    static_assert(sizeof(U_ptr<uint8_t>) == sizeof(uint8_t*), "U_ptr must be pointer sized");
+
     /**
      * Create a new instance of U_ptr<T> holding a default T.
      * @param T can be any type.
@@ -107,7 +160,7 @@ namespace Memory
     template<typename T>
     U_ptr<T> make_unique(void)
     {
-        return { new T{ } };
+        return { track(new T{ }) };
     }
 
     /**
@@ -119,9 +172,9 @@ namespace Memory
      * @return a new instance of U_ptr<T> wrapping the instanced object.
      */
     template<typename T, class... Args>
-    U_ptr<T> make_unique(Args&&... args)
+    typename EnableIf<!IsAllocatorTag<Args...>::value, U_ptr<T>>::type make_unique(Args&&... args)
     {
-        return { new T{ args... } };
+        return { track(new T{ Memory::forward<Args>(args)... }) };
     }
 
     /**
@@ -134,7 +187,7 @@ namespace Memory
     template<typename T, typename U>
     U_ptr<T> make_unique(void)
     {
-        return { new U{ } };
+        return { track(new U{ }) };
     }
 
     /**
@@ -147,8 +200,116 @@ namespace Memory
      * @return a new U_ptr<T> wrapping the newly instanced U.
      */
     template<typename T, typename U, class... Args>
-    U_ptr<T> make_unique(Args&&... args)
+    typename EnableIf<!IsAllocatorTag<Args...>::value, U_ptr<T>>::type make_unique(Args&&... args)
+    {
+        return { track(new U{ Memory::forward<Args>(args)... }) };
+    }
+
+    /**
+     * Creates a new instance of U_ptr<T> holding an instance of U allocated
+     * within the provided Pool. The block goes back to the Pool when the
+     * U_ptr releases the object.
+     * @param T can be any type.
+     * @param U is T or a derived type of T. Deduced from the Pool.
+     * @param N number of blocks of the Pool.
+     * @param Args types of arguments.
+     * @param pool tag selecting the Pool to allocate from.
+     * @param args must match one of U's constructors.
+     * @return a new U_ptr<T> wrapping the newly instanced U, or nullptr
+     *         if the Pool is exhausted.
+     */
+    template<typename T, typename U, uint16_t N, class... Args>
+    U_ptr<T, PoolDelete<U, N>> make_unique(const Pool<U, N>& pool, Args&&... args)
+    {
+        auto block = pool.allocate();
+        if (block == nullptr)
+        {
+            return { };
+        }
+        return { static_cast<T*>(track(new (block) U{ Memory::forward<Args>(args)... })) };
+    }
+
+    /**
+     * Creates a new instance of U_ptr<T> holding an instance of U allocated
+     * within the provided Arena. The object gets destroyed by the U_ptr,
+     * but its memory is freed only along with the whole Arena.
+     * @param T can be any type.
+     * @param U is T or a derived type of T. T by default.
+     * @param Args types of arguments.
+     * @param arena to allocate from.
+     * @param args must match one of U's constructors.
+     * @return a new U_ptr<T, ArenaDelete<T>> wrapping the newly instanced U,
+     *         or nullptr if the Arena is full.
+     */
+    template<typename T, typename U = T, class... Args>
+    U_ptr<T, ArenaDelete<T>> make_unique(Arena& arena, Args&&... args)
+    {
+        auto memory = arena.allocate(sizeof(U), alignof(U));
+        if (memory == nullptr)
+        {
+            return { };
+        }
+        return { static_cast<T*>(track(new (memory) U{ Memory::forward<Args>(args)... })) };
+    }
+
+    /**
+     * Creates a new instance of U_ptr<T> holding a short lived instance of U.
+     * Allocates within the Arena of the innermost ArenaScope if any and if
+     * there is room left, upon the heap otherwise. Intended for temporaries
+     * that never outlive the current ArenaScope, e.g. iterators.
+     * @param T can be any type.
+     * @param U is T or a derived type of T. T by default.
+     * @param Args types of arguments.
+     * @param args must match one of U's constructors.
+     * @return a new U_ptr<T, ArenaDelete<T>> wrapping the newly instanced U.
+     */
+    template<typename T, typename U = T, class... Args>
+    U_ptr<T, ArenaDelete<T>> make_scoped(Args&&... args)
+    {
+        auto arena = Arena::active();
+        auto memory = arena == nullptr ? nullptr : arena->allocate(sizeof(U), alignof(U));
+        if (memory == nullptr)
+        {
+            return { track(new U{ Memory::forward<Args>(args)... }), ArenaDelete<T>{ false } };
+        }
+        return { static_cast<T*>(track(new (memory) U{ Memory::forward<Args>(args)... })) };
+    }
+
+    /**
+     * Creates a new instance of U_ptr<T> holding an instance of U created
+     * with the allocation policy A. The memory goes back to A when the
+     * U_ptr releases the object. Unlike make_unique, A is never mistaken
+     * for an argument of U's constructor, whatever its type (e.g. a Pool).
+     * @param T can be any type.
+     * @param A allocation policy.
+     * @param U is T or a derived type of T. T by default.
+     * @param Args types of arguments.
+     * @param args must match one of U's constructors.
+     * @return a new U_ptr<T> wrapping the newly instanced U, or nullptr
+     *         if A ran out of memory.
+     */
+    template<typename T, typename A, typename U = T, class... Args>
+    U_ptr<T, AllocatorDelete<A, U>> allocate_unique(Args&&... args)
+    {
+        return { static_cast<T*>(create<U, A>(Memory::forward<Args>(args)...)) };
+    }
+
+    /**
+     * Creates a new instance of U_ptr<T> holding an instance of U created
+     * with the provided allocation policy. The memory goes back to the
+     * allocation policy when the U_ptr releases the object.
+     * @param T can be any type.
+     * @param U is T or a derived type of T. T by default.
+     * @param A allocation policy.
+     * @param Args types of arguments.
+     * @param args must match one of U's constructors.
+     * @return a new U_ptr<T> wrapping the newly instanced U, or nullptr
+     *         if the allocation policy ran out of memory.
+     */
+    template<typename T, typename U = T, typename A, class... Args>
+    typename EnableIf<IsAllocatorTag<A>::value, U_ptr<T, AllocatorDelete<A, U>>>::type 
+    make_unique(const A&, Args&&... args)
     {
-        return { new U{ args... } };
+        return allocate_unique<T, A, U>(Memory::forward<Args>(args)...);
     }
 }
\ No newline at end of file
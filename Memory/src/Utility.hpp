@@ -0,0 +1,140 @@
+/*
+ * ----------------------------------------------------------------------------
+ * Utility
+ * Type traits and helpers for Memory, since Arduino has no standard library.
+ * Part of the ArduinoLibraries project, to be used with any Arduino board.
+ * <https://github.com/Pierrolefou881/ArduinoLibraries>
+ * ----------------------------------------------------------------------------
+ *
+ * Copyright (C) 2025  Pierre DEBAS
+ * <dpierre394@gmail.com>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#pragma once
+#include <stddef.h>
+
+// Placement new. AVR cores ship it in new.h, other cores provide <new>.
+#if defined(__AVR__)
+#include <new.h>
+#else
+#include <new>
+#endif
+
+namespace Memory
+{
+    /**
+     * Exposes type as T if Condition is true, nothing otherwise.
+     * Used to discard function overloads at compile time.
+     */
+    template<bool Condition, typename T = void>
+    struct EnableIf { };
+
+    template<typename T>
+    struct EnableIf<true, T> { typedef T type; };
+
+    /**
+     * Strips reference, const and volatile qualifiers from T.
+     */
+    template<typename T> struct Bare { typedef T type; };
+    template<typename T> struct Bare<T&> : Bare<T> { };
+    template<typename T> struct Bare<T&&> : Bare<T> { };
+    template<typename T> struct Bare<const T> : Bare<T> { };
+    template<typename T> struct Bare<volatile T> : Bare<T> { };
+    template<typename T> struct Bare<const volatile T> : Bare<T> { };
+
+    /**
+     * value is true if From implicitly converts to To.
+     */
+    template<typename From, typename To>
+    class IsConvertible
+    {
+        static From make(void);
+        static char test(To);
+        static long test(...);
+
+    public:
+        static const bool value{ sizeof(test(make())) == sizeof(char) };
+    };
+
+    /**
+     * value is true if T can be copied byte by byte, e.g. integers, enums
+     * or plain structs. Such T have a trivial destructor as well.
+     */
+    template<typename T>
+    struct IsTriviallyCopyable
+    {
+        static const bool value{ __is_trivially_copyable(T) };
+    };
+
+    /**
+     * Strips reference qualifiers from T.
+     */
+    template<typename T> struct RemoveReference { typedef T type; };
+    template<typename T> struct RemoveReference<T&> { typedef T type; };
+    template<typename T> struct RemoveReference<T&&> { typedef T type; };
+
+    /**
+     * Same as std::move, which AVR cores do not provide. Always call it
+     * qualified, Memory::move, so that argument dependent lookup never
+     * picks another move.
+     * @param value to move from.
+     * @return value as an rvalue reference.
+     */
+    template<typename T>
+    typename RemoveReference<T>::type&& move(T&& value) noexcept
+    {
+        return static_cast<typename RemoveReference<T>::type&&>(value);
+    }
+
+    /**
+     * Same as std::forward, which AVR cores do not provide. Always call
+     * it qualified, Memory::forward.
+     * @param T deduced type of a forwarding reference.
+     * @param value forwarding reference to pass on.
+     * @return value with its original value category.
+     */
+    template<typename T>
+    T&& forward(typename RemoveReference<T>::type& value) noexcept
+    {
+        return static_cast<T&&>(value);
+    }
+
+    template<typename T>
+    T&& forward(typename RemoveReference<T>::type&& value) noexcept
+    {
+        return static_cast<T&&>(value);
+    }
+
+    /**
+     * Base type for allocation tags. Passing a tag as first argument
+     * of make_unique or make_shared selects where the object is allocated.
+     */
+    struct AllocatorTag { };
+
+    /**
+     * value is true if the first type of Args is an allocation tag.
+     */
+    template<class... Args>
+    struct IsAllocatorTag
+    {
+        static const bool value{ false };
+    };
+
+    template<typename First, class... Args>
+    struct IsAllocatorTag<First, Args...>
+    {
+        static const bool value{ __is_base_of(AllocatorTag, typename Bare<First>::type) };
+    };
+}